@@ -53,11 +53,35 @@ public:
 private:
     class Data {
     public:
-        U32 fd;
-        U64 data;
-        U32 events;
+        U32 fd = 0;
+        U64 data = 0;
+        U32 events = 0;
+        std::weak_ptr<KObject> kobject;
+        BOXEDWINE_CONDITION watchCond; // stays registered with the object until the fd is removed
+
+        // guarded by ReadyList::mutex
+        bool ready = false;
+        bool removed = false;
+        bool disabled = false; // EPOLLONESHOT was reported, waits for EPOLL_CTL_MOD
     };
-    BHashTable<U32, Data*> data;
+
+    // the callbacks on the watch conditions can outlive the epoll object, so they hold on to this instead of the epoll
+    class ReadyList {
+    public:
+        void add(const std::shared_ptr<Data>& d);
+
+        BOXEDWINE_MUTEX mutex;
+        std::deque<std::shared_ptr<Data>> list;
+    };
+
+    void watch(const std::shared_ptr<Data>& d, const std::shared_ptr<KObject>& kobject);
+    void unwatch(const std::shared_ptr<Data>& d);
+    U32 getReadyEvents(KMemory* memory, U32 events, U32 maxevents);
+
+    BOXEDWINE_MUTEX dataMutex;
+    BHashTable<U32, std::shared_ptr<Data>> data;
+    std::shared_ptr<ReadyList> ready;
+    BOXEDWINE_CONDITION cond; // parent of every watch condition, epoll_wait waits on this
 };
 
 #endif
\ No newline at end of file
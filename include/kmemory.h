@@ -70,6 +70,18 @@ struct LockData32 {
 struct LockData64 {
     U64 data;
 };
+
+// held while a LOCK prefixed access that can't use a host atomic, see KMemory::getLockPtr, is done with read/write.  It
+// locks the stripe of each page the access touches, so two of these accesses that overlap always share a stripe.
+class KMemoryStripeLock {
+public:
+    KMemoryStripeLock(U32 address, U32 len);
+    ~KMemoryStripeLock();
+
+private:
+    BOXEDWINE_MUTEX* first;
+    BOXEDWINE_MUTEX* second;
+};
 #endif
 class KMemory {
 private:
@@ -127,6 +139,15 @@ public:
     void unlockMemory(U8* lockedPointer);
 
     U8* getRamPtr(U32 address, U32 len, bool write, bool futex = false);
+    // a write pointer like getRamPtr, but nullptr for a page that holds translated code.  Those have to go through
+    // writeb/w/d so that the code is only removed when a value changes and while the write holds the memory mutex.
+    U8* getDataRamPtr(U32 address, U32 len);
+#ifdef BOXEDWINE_MULTI_THREADED
+    // host memory for a LOCK prefixed access of len bytes so that it can be done with a host atomic, nullptr if the
+    // access isn't aligned, the page holds translated code or the page can't be written directly.  Then the caller should do the access with read/write
+    // while it holds a KMemoryStripeLock, which will also raise any fault.
+    U8* getLockPtr(U32 address, U32 len);
+#endif
 
     // caller is responsible for making sure the address+len is valid
     void iteratePages(U32 address, U32 len, std::function<bool(U32 page)> callback);
@@ -162,6 +183,8 @@ private:
     KMemoryData* data;    
     KProcess* process;
 
+    void cloneRegion(KMemory* from, U32 region);
+
     class LockedMemory {
     public:
         ~LockedMemory() {
@@ -20,6 +20,7 @@
 #define __KNATIVESCREEN_H__
 
 #include "knativeinput.h"
+#include "../source/util/damageregion.h"
 
 class XCursor;
 
@@ -42,8 +43,8 @@ public:
 
 	virtual void clear() = 0;
 	// id is used for texture caching
-	// if isDirty is false then the cached texture will be drawn
-	virtual void putBitsOnWnd(U32 id, U8* bits, U32 bitsPerPixel, U32 srcPitch, S32 dstX, S32 dstY, U32 width, U32 height, U32* palette, bool isDirty) = 0;
+	// only the damaged parts of bits are uploaded, if damage is empty then the cached texture will be drawn
+	virtual void putBitsOnWnd(U32 id, U8* bits, U32 bitsPerPixel, U32 srcPitch, S32 dstX, S32 dstY, U32 width, U32 height, U32* palette, const DamageRegion& damage) = 0;
 	virtual void present() = 0;
 	virtual bool presentedSinceLastCheck() = 0;
 	virtual void clearTextureCache(U32 id) = 0;	
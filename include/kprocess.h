@@ -37,6 +37,10 @@ public:
     U64 len = 0;
     U64 offset = 0;
     U32 key = 0; // key to KProcess::mappedFiles
+
+    // used by FilePage::onDemmand to grow the fault around window while faults are sequential
+    U64 nextFaultOffset = 0;
+    U32 faultAroundPages = 0;
 };
 
 typedef std::shared_ptr<MappedFile> MappedFilePtr;
@@ -277,6 +281,7 @@ public:
 #ifdef BOXEDWINE_BINARY_TRANSLATOR
     bool emulateFPU = false;
     void* reTranslateChunkAddress = nullptr; // will be called when the program tries to jump to memory that hasn't been translated yet or needs to be retranslated
+    void* retranslateHotChunkAddress = nullptr; // will be called when a chunk has run enough times to be translated again as a superblock
     void* syncToHostAddress = nullptr;
     void* syncFromHostAddress = nullptr;
     void* doSingleOpAddress = nullptr;
@@ -347,6 +352,7 @@ public:
     std::shared_ptr<FsNode> processNode; // in /proc/<pid>
     std::shared_ptr<FsNode> taskNode; // in /proc/<pid>/task
     std::shared_ptr<FsNode> fdNode; // in /proc/<pid>/fd
+    FsMissingPaths missingPaths;
 };
 
 #endif
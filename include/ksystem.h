@@ -50,6 +50,30 @@ public:
     const BString name;
     std::shared_ptr<KFile> file;
     std::vector<RamPage> data;
+
+    // returns the host mapping of the file page or nullptr if the file can't be mapped by the host
+    U8* getNativePage(U32 page);
+
+    // optional store of the file's pages that survives restarts, see KSystem::pageCachePath.  Only files that the host
+    // can't map directly, like files in a zip file system, are stored.
+    bool isPageStored(U32 page);
+    bool readStoredPage(U32 page, U8* buffer);
+    void storePages(U32 page, U32 count, const U8* buffer);
+
+private:
+    void init();
+    void openStore();
+
+    BOXEDWINE_MUTEX mutex;
+    bool initialized = false;
+    bool canMapFile = false;
+    U8* nativePages = nullptr; // each file page is mapped on demand with an unmapped guard page after it
+    U32 nativeBlockCount = 0;
+    std::vector<bool> nativePageMapped;
+
+    S32 storeHandle = -1;
+    U64 storeDataOffset = 0;
+    std::vector<U8> storeBitmap;
 };
 
 class SHM {
@@ -105,6 +129,10 @@ public:
     static bool disableHideCursor;
     static bool forceRelativeMouse;
     static bool cacheReads;
+    static U32 zipCacheMB;
+    static U32 faultAroundPages;
+    static BString pageCachePath;
+    static BString codeCachePath;
     static bool useF64;
 
     static void init();
@@ -139,6 +167,7 @@ public:
     static U32 shmat(KThread* thread, U32 shmid, U32 shmaddr, U32 shmflg, U32 rtnAddr, U32* nativeRtnAddr);
     static U32 shmdt(KThread* thread, U32 shmaddr);
     static U32 shmctl(KThread* thread, U32 shmid, U32 cmd, U32 buf);
+    static std::shared_ptr<SHM> getSHM(KThread* thread, U32 shmid);
     static U32 sysinfo(KThread* thread, U32 address);
     static U32 times(KThread* thread, U32 buf);
     static U32 tgkill(U32 threadGroupId, U32 threadId, U32 signal);
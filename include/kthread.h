@@ -42,6 +42,7 @@ typedef std::shared_ptr<OpenGLVetexPointer> OpenGLVetexPointerPtr;
 class KProcess;
 class Memory;
 class Wnd;
+class KFutexWaiter;
 
 class KThreadGlContext {
 public:
@@ -191,7 +192,7 @@ private:
     struct user_desc tls[TLS_ENTRIES] = {};
     BOXEDWINE_MUTEX tlsMutex;
 
-    static BOXEDWINE_MUTEX_NR futexesMutex;
+    KFutexWaiter* futexWaiter = nullptr; // a thread waits on at most one futex at a time
 };
 
 class ChangeThread {
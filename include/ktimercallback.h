@@ -19,17 +19,19 @@
 #ifndef __KTIMERCALLBACK_H__
 #define __KTIMERCALLBACK_H__
 
+#define K_TIMER_NOT_QUEUED 0xFFFFFFFF
+
 class KTimerCallback {
 public:
-    KTimerCallback() : node(this), millies(0), resetMillies(0), active(false) {}
+    KTimerCallback() : micros(0), resetMillies(0), active(false), heapIndex(K_TIMER_NOT_QUEUED) {}
     ~KTimerCallback();
 
-    virtual bool run() = 0; // return true of the timer should be removed, don't remove a timer manually in run because it will invalidate the iterator
+    virtual bool run() = 0; // return true if the timer should be removed, otherwise it will be rescheduled at the new value of micros
 
-    KListNode<KTimerCallback*> node;
-    U32 millies;
+    U64 micros; // KSystem::getMicroCounter() value when the timer should run
     U32 resetMillies;
     bool active;
+    U32 heapIndex; // position in the scheduler's timer heap
 };
 
 #endif
\ No newline at end of file
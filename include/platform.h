@@ -125,6 +125,7 @@ public:
     static void releaseNativeMemory(void* address, U64 len);
     static U8* alloc64kBlock(U32 count, bool executable = false);
     static BString procStat();
+    static BString getExecutablePath(); // empty if the host can't tell
     static U8* reserveNativeMemory64k(U32 count);
     static void commitNativeMemoryPage(void* address);
 
@@ -178,5 +179,8 @@ void PlaySysex(U8 * sysex,U32 len);
 #define DEFAULT_POLL_RATE 0
 #define DEFAULT_POLL_RATE_str "0"
 
+#define DEFAULT_ZIP_CACHE_MB 64
+#define DEFAULT_FAULT_AROUND_PAGES 16
+
 bool isMainthread();
 #endif
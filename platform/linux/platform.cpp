@@ -221,6 +221,25 @@ BString Platform::procStat() {
     return BReadFile(B("/proc/stat")).readAll();
 }
 
+#ifdef __MACH__
+#include <mach-o/dyld.h>
+#endif
+
+BString Platform::getExecutablePath() {
+#ifdef __MACH__
+    char path[PATH_MAX];
+    uint32_t size = sizeof(path);
+    if (_NSGetExecutablePath(path, &size) == 0) {
+        return BString::copy(path);
+    }
+    return BString();
+#elif defined(__EMSCRIPTEN__)
+    return BString();
+#else
+    return B("/proc/self/exe");
+#endif
+}
+
 U8* Platform::reserveNativeMemory64k(U32 count) {
     U8* result = (U8*)mmap(NULL, 64 * 1024 * count, PROT_NONE, MAP_ANONYMOUS | MAP_PRIVATE , -1, 0);
     if (result == MAP_FAILED) {
@@ -90,7 +90,7 @@ void syncFromException(Armv8btCPU* cpu, ucontext_t* context) {
 #endif
     cpu->flags = (U32)context->CONTEXT_REG(xFLAGS);
     cpu->lazyFlags = FLAGS_NONE;
-    cpu->eip.u32 = getMemData(cpu->memory)->codeCache.getEipFromHost((U8*)context->CONTEXT_PC);
+    cpu->eip.u32 = getMemData(cpu->memory)->getEipFromHost((U8*)context->CONTEXT_PC);
     
 #ifdef __MACH__
     for (int i = 0; i < 8; i++) {
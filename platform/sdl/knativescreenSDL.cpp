@@ -184,7 +184,7 @@ void KNativeScreenSDL::clear() {
     }
 }
 
-void KNativeScreenSDL::putBitsOnWnd(U32 id, U8* bits, U32 bitsPerPixel, U32 srcPitch, S32 dstX, S32 dstY, U32 width, U32 height, U32* palette, bool isDirty) {
+void KNativeScreenSDL::putBitsOnWnd(U32 id, U8* bits, U32 bitsPerPixel, U32 srcPitch, S32 dstX, S32 dstY, U32 width, U32 height, U32* palette, const DamageRegion& damage) {
     if (!bitsPerPixel || !srcPitch) {
         return;
     }
@@ -201,46 +201,58 @@ void KNativeScreenSDL::putBitsOnWnd(U32 id, U8* bits, U32 bitsPerPixel, U32 srcP
 
     U32 bpp = 32;
     U32 dstPitch = (width * ((bpp + 7) / 8) + 3) & ~3;
+    bool canCreateTexture = KSystem::videoOption != VIDEO_NO_WINDOW && renderer;
+    bool resized = wnd->sdlTextureHeight != height || wnd->sdlTextureWidth != width;
+    const DamageRegion* dirty = &damage;
+    DamageRegion all;
 
-    if (wnd->sdlTexture && (wnd->sdlTextureHeight != height || wnd->sdlTextureWidth != width)) {
+    if (wnd->sdlTexture && resized) {
         SDL_DestroyTexture(wnd->sdlTexture);
         wnd->sdlTexture = nullptr;
-        isDirty = true;
     }
-    if (isDirty) {
+    if (resized || (!wnd->sdlTexture && canCreateTexture)) {
+        // nothing from before is in a new texture or in the converted bits
+        all.addAll(width, height);
+        dirty = &all;
+    }
+    if (!dirty->isEmpty()) {
         lastUpdateTime = KSystem::getMilliesSinceStart();
     }
     if (!wnd->sdlTexture) {
-        if (KSystem::videoOption != VIDEO_NO_WINDOW && renderer) {
+        if (canCreateTexture) {
             wnd->sdlTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, width, height);
         }
         wnd->sdlTextureHeight = height;
         wnd->sdlTextureWidth = width;
     }
-    if (isDirty && bitsPerPixel == 8) {
+    if (bitsPerPixel == 8) {
         wnd->ensureSize(dstPitch * height);
-        for (U32 y = 0; y < height; y++) {
-            U8* srcLine = bits + srcPitch * y;
-            U32* dstLine = (U32*)(wnd->bits + dstPitch * y);
-            for (U32 x = 0; x < width; x++, dstLine++, srcLine++) {
-                *dstLine = palette[*srcLine];
+        for (auto& d : dirty->rects) {
+            for (S32 y = d.top; y < d.bottom && y < (S32)height; y++) {
+                U8* srcLine = bits + srcPitch * y + d.left;
+                U32* dstLine = (U32*)(wnd->bits + dstPitch * y) + d.left;
+                for (S32 x = d.left; x < d.right && x < (S32)width; x++, dstLine++, srcLine++) {
+                    *dstLine = palette[*srcLine];
+                }
             }
         }
         bits = wnd->bits;
-    } else if (isDirty && bitsPerPixel == 16) {
+    } else if (bitsPerPixel == 16) {
         wnd->ensureSize(dstPitch * height);
-        for (U32 y = 0; y < height; y++) {
-            U16* srcLine = (U16*)(bits + srcPitch * y);
-            U32* dstLine = (U32*)(wnd->bits + dstPitch * y);
-            for (U32 x = 0; x < width; x++, dstLine++, srcLine++) {
-                U32 r = (*srcLine & 0xF800) >> 11;
-                U32 g = (*srcLine & 0x07E0) >> 5;
-                U32 b = *srcLine & 0x001F;
-
-                r = (r * 255) / 31;
-                g = (g * 255) / 63;
-                b = (b * 255) / 31;
-                *dstLine = (r << 16) | (g << 8) | b;
+        for (auto& d : dirty->rects) {
+            for (S32 y = d.top; y < d.bottom && y < (S32)height; y++) {
+                U16* srcLine = (U16*)(bits + srcPitch * y) + d.left;
+                U32* dstLine = (U32*)(wnd->bits + dstPitch * y) + d.left;
+                for (S32 x = d.left; x < d.right && x < (S32)width; x++, dstLine++, srcLine++) {
+                    U32 r = (*srcLine & 0xF800) >> 11;
+                    U32 g = (*srcLine & 0x07E0) >> 5;
+                    U32 b = *srcLine & 0x001F;
+
+                    r = (r * 255) / 31;
+                    g = (g * 255) / 63;
+                    b = (b * 255) / 31;
+                    *dstLine = (r << 16) | (g << 8) | b;
+                }
             }
         }
         bits = wnd->bits;
@@ -290,8 +302,15 @@ void KNativeScreenSDL::putBitsOnWnd(U32 id, U8* bits, U32 bitsPerPixel, U32 srcP
 #endif     
 
     if (KSystem::videoOption != VIDEO_NO_WINDOW && renderer) {
-        if (isDirty) {
-            SDL_UpdateTexture(wnd->sdlTexture, nullptr, bits, dstPitch);
+        for (auto& d : dirty->rects) {
+            SDL_Rect rect;
+            rect.x = d.left;
+            rect.y = d.top;
+            rect.w = std::min(d.right, (S32)width) - d.left;
+            rect.h = std::min(d.bottom, (S32)height) - d.top;
+            if (rect.w > 0 && rect.h > 0) {
+                SDL_UpdateTexture(wnd->sdlTexture, &rect, bits + dstPitch * d.top + d.left * 4, dstPitch);
+            }
         }
 
         SDL_Rect dstrect;
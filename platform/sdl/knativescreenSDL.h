@@ -83,7 +83,7 @@ public:
     U32 getLastUpdateTime() override;
 
     void clear() override;
-    void putBitsOnWnd(U32 id, U8* bits, U32 bitsPerPixel, U32 srcPitch, S32 dstX, S32 dstY, U32 width, U32 height, U32* palette, bool isDirty) override;
+    void putBitsOnWnd(U32 id, U8* bits, U32 bitsPerPixel, U32 srcPitch, S32 dstX, S32 dstY, U32 width, U32 height, U32* palette, const DamageRegion& damage) override;
     void present() override;
     bool presentedSinceLastCheck() override;
     void clearTextureCache(U32 id) override;
@@ -161,6 +161,15 @@ This file is part of Cygwin.
 This software is a copyrighted work licensed under the terms of the
 Cygwin license.  Please consult the file "CYGWIN_LICENSE" for
 details. */
+BString Platform::getExecutablePath() {
+    char path[MAX_PATH];
+    DWORD len = GetModuleFileNameA(NULL, path, MAX_PATH);
+    if (len == 0 || len >= MAX_PATH) {
+        return BString();
+    }
+    return BString::copy(path, (int)len);
+}
+
 BString Platform::procStat() {
     U32 pages_in = 0UL, pages_out = 0UL, interrupt_count = 0UL, context_switches = 0UL, swap_in = 0UL, swap_out = 0UL;
     U32 cpuCount = getCpuCount();
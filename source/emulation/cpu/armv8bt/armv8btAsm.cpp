@@ -38,6 +38,7 @@ static bool isWidthVector(VectorWidth width) {
 }
 
 U32 Armv8btAsm::flagsNeeded() {
+    limitBlockToChunk(this->currentBlock);
     return DecodedOp::getNeededFlags(this->currentBlock, this->currentOp, instructionInfo[this->currentOp->inst].flagsSets & ~MAYBE);
 }
 
@@ -2088,6 +2089,11 @@ void Armv8btAsm::jmpRegToxBranchEip(bool mightNeedCS) {
         branchNativeRegister(xBranch);
         }, nullptr, nullptr, false, false);
 
+    U8 tmpReg = getTmpReg();
+    shiftRegRightWithValue32(tmpReg, xOffset, K_EIP_SLICE_SHIFT); // get slice
+    readMem64RegOffset(xBranch, xBranch, tmpReg, 3); // get slice for offset, it is adjusted so that it can be indexed by the offset
+    releaseTmpReg(tmpReg);
+
     readMem64RegOffset(xBranch, xBranch, xOffset, 3); // read value at offset for page
 
     cmpValue64(xBranch, 0);
@@ -2111,6 +2117,7 @@ void Armv8btAsm::doJmp(bool mightNeedCS) {
 }
 
 static void armv8_translateIfNecessary(Armv8btCPU* cpu) {
+    cpu->leftTranslatedCode();
     if (!cpu->isBig()) {
         cpu->eip.u32 = cpu->eip.u32 & 0xFFFF;
     }
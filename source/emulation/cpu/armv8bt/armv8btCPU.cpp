@@ -125,7 +125,7 @@ void* Armv8btCPU::init() {
     result = chunk->getHostAddress();
     //link(&data, chunk);
     this->pendingCodePages.clear();    
-    this->eipToHostInstructionPages = mem->eipToHostInstructionPages;
+    this->eipToHostInstructionPages = (U8****)mem->eipToHostInstructionPages;
 
     if (!this->thread->process->returnToLoopAddress) {
         Armv8btAsm returnData(this);
@@ -244,30 +244,16 @@ void Armv8btCPU::translateData(BtData* data, BtData* firstPass) {
         }
         if (!data->currentOp) {            
             DecodedBlock* prev = data->currentBlock;
+            // always decode a new block instead of using the one from a chunk that already contains this address, this
+            // might be running without KMemory::mutex and that chunk, along with its block, can be released at any time
+            data->currentBlock = NormalCPU::getBlockForInspectionButNotUsed(this, address, big);
             if (prev) {
-                data->currentBlock = nullptr; // don't chain to an existing block
-            } else {
-                std::shared_ptr<BtCodeChunk> chunk = memory->findCodeBlockContaining(address, 1);
-                if (chunk) {
-                    data->currentBlock = chunk->block;
-                    if (data->currentBlock) {
-                        data->currentOp = data->currentBlock->getOp(address);
-                        if (!data->currentOp) {
-                            // winfish seems to jump into the middle of an instruction which changes it from cmp to mov
-                            data->currentBlock = nullptr;
-                        }
-                    }
-                }
-            }
-            if (!data->currentBlock) {
-                data->currentBlock = NormalCPU::getBlockForInspectionButNotUsed(this, address, big);
-                if (prev) {
-                    prev->bytes += data->currentBlock->bytes;
-                    prevOp->next = data->currentBlock->op;
-                    data->currentBlock->op = nullptr;
-                    data->currentBlock->dealloc(false);
-                    data->currentBlock = prev;
-                }
+                prev->bytes += data->currentBlock->bytes;
+                prevOp->next = data->currentBlock->op;
+                prev->clearNeededFlagsCache();
+                data->currentBlock->op = nullptr;
+                data->currentBlock->dealloc(false);
+                data->currentBlock = prev;
             }
             data->currentOp = data->currentBlock->getOp(address);
         }
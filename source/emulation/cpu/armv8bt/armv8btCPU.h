@@ -32,7 +32,7 @@ public:
     virtual void* init() override;
 
     U8* parity_lookup;                
-	U8*** eipToHostInstructionPages;    
+	U8**** eipToHostInstructionPages;    
 
     SSE sseConstants[6];
 
@@ -4219,6 +4219,7 @@ void opCmpXchg8b(Armv8btAsm* data) {
     //     EDX = (U32)(value2 >> 32);
     //     EAX = (U32)value2;
     // }
+    data->limitBlockToChunk(data->currentBlock);
     U32 flags = DecodedOp::getNeededFlags(data->currentBlock, data->currentOp, CF | SF | PF | AF | OF | ZF);
     
     U8 addressReg = data->getAddressReg();    
@@ -0,0 +1,538 @@
+/*
+ *  Copyright (C) 2012-2025  The BoxedWine Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#include "boxedwine.h"
+
+#ifdef BOXEDWINE_BINARY_TRANSLATOR
+
+#include "btChunkStore.h"
+#include "btCpu.h"
+#include "btData.h"
+#include "btCodeChunk.h"
+#include "../normal/normalCPU.h"
+#include "../../softmmu/kmemory_soft.h"
+#ifdef BOXEDWINE_X64
+#include "../x64/x64CPU.h"
+#endif
+#include "crc.h"
+
+#include UNISTD
+#include <fcntl.h>
+
+#define CHUNK_STORE_MAGIC 0x53435742 // BWCS
+#define CHUNK_STORE_VERSION 3
+#define CHUNK_STORE_MAX_SIZE 0x10000000 // once the file gets this big nothing else is added, the next run starts over
+#define CHUNK_STORE_WRITE_SIZE 0x10000 // chunks are written out in batches of about this size
+#define CHUNK_STORE_READ_SIZE 0x10000 // record headers are read in blocks of this size when the store is opened
+#define CHUNK_STORE_MAX_LEN 0x100000 // sanity check for the lengths in a record
+
+#define CHUNK_STORE_ALIGN(x) (((x) + 7) & ~7)
+
+class ChunkStoreHeader {
+public:
+    U32 magic;
+    U32 version;
+};
+
+// followed by the guest bytes the translation depended on, the eip offset and host offset of each instruction, the host
+// code and then the relocations.  More than one build can share the store, each record says which one wrote it.
+class ChunkStoreRecord {
+public:
+    U32 magic;
+    U32 len; // including this header
+    U64 build;
+    U32 address;
+    U32 csAddress;
+    U32 flags;
+    U32 eipLen;
+    U32 guestLen;
+    U32 instructionCount;
+    U32 hostLen;
+    U32 relocationCount;
+    U32 crc; // of the data after the record, a record that was only partly written or got damaged is skipped
+    U32 unused;
+};
+
+class ChunkStoreRelocation {
+public:
+    U32 pos;
+    U32 type;
+    U64 value; // offset from imageAnchor for BT_RELOCATION_IMAGE, op index + 1 for BT_RELOCATION_OP (0 is nullptr) and offset into the block for BT_RELOCATION_BLOCK
+};
+
+class StoredChunk {
+public:
+    ChunkStoreRecord record = {};
+    U64 offset = 0; // where data starts in the file, data is only read when the chunk might be used
+    std::vector<U8> data; // everything after the record, each part is 8 byte aligned.  Empty once it is in the file
+    std::shared_ptr<StoredChunk> next; // older chunk at the same address, never changes once the chunk is in storedChunks
+
+    static U64 getDataLen(const ChunkStoreRecord& record) {
+        return CHUNK_STORE_ALIGN((U64)record.guestLen) + (U64)record.instructionCount * 8 + CHUNK_STORE_ALIGN((U64)record.hostLen) + (U64)record.relocationCount * sizeof(ChunkStoreRelocation);
+    }
+
+    U8* guest() { return data.data(); }
+    U32* eipOffsets() { return (U32*)(data.data() + CHUNK_STORE_ALIGN(record.guestLen)); }
+    U32* hostOffsets() { return eipOffsets() + record.instructionCount; }
+    U8* host() { return (U8*)(hostOffsets() + record.instructionCount); }
+    ChunkStoreRelocation* relocations() { return (ChunkStoreRelocation*)(host() + CHUNK_STORE_ALIGN(record.hostLen)); }
+};
+
+std::atomic<U32> BtChunkStore::loadedChunks;
+
+static BOXEDWINE_MUTEX storeMutex;
+static bool storeOpened;
+static int storeHandle = -1;
+static U64 storeSize;
+static BHashTable<U32, std::shared_ptr<StoredChunk>> storedChunks;
+static std::vector<U8> pendingWrites;
+static std::vector<std::shared_ptr<StoredChunk>> pendingChunks; // the chunks in pendingWrites, they keep their data until written
+static U64 buildId;
+
+// functions and static data are relocated relative to this, they are all part of the same executable
+static void imageAnchor() {
+}
+
+static U64 hashBytes(U64 hash, const void* p, U32 len) {
+    const U8* bytes = (const U8*)p;
+    for (U32 i = 0; i < len; i++) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+static U32 getDataCrc(const U8* data, U64 len) {
+    return crc32b((unsigned char*)data, (int)len);
+}
+
+// the stored code calls into the build that wrote it, where other functions ended up will change with almost any
+// change to the executable, so the id is a hash of the executable itself.  The rest only matters if it can't be read.
+static U64 getBuildId() {
+    const char* version = BOXEDWINE_VERSION_STR " " __DATE__ " " __TIME__
+#ifdef BOXEDWINE_4K_PAGE_SIZE
+        " 4k"
+#endif
+        ;
+    U64 offsets[] = { (U64)crc32b - (U64)imageAnchor, (U64)NormalCPU::getBlockForInspectionButNotUsed - (U64)imageAnchor, (U64)KSystem::init - (U64)imageAnchor, sizeof(BtCPU), sizeof(DecodedOp), sizeof(DecodedBlock) };
+    U64 result = hashBytes(0xcbf29ce484222325ull, version, (U32)strlen(version));
+    result = hashBytes(result, offsets, sizeof(offsets));
+
+    BString path = Platform::getExecutablePath();
+    if (path.length()) {
+        BReadFile file(path);
+        if (file.isOpen()) {
+            std::vector<U8> buffer(CHUNK_STORE_READ_SIZE);
+            U32 read;
+            while ((read = file.read(buffer.data(), buffer.size())) > 0 && read <= buffer.size()) {
+                result = hashBytes(result, buffer.data(), read);
+            }
+            return result;
+        }
+    }
+    klog("code cache could not read the executable, stored code will only be checked against the build time");
+    return result;
+}
+
+// what the translator looks at besides the guest code
+static U32 getTranslationFlags(BtCPU* cpu) {
+    U32 result = cpu->isBig() ? 1 : 0;
+    if (cpu->thread->process->emulateFPU) {
+        result |= 2;
+    }
+    for (U32 i = 0; i < 6; i++) {
+        if (cpu->thread->process->hasSetSeg[i]) {
+            result |= 4 << i;
+        }
+    }
+#ifdef BOXEDWINE_4K_PAGE_SIZE
+    if (cpu->use4kMemCheck) {
+        result |= 0x100;
+    }
+#endif
+#ifdef BOXEDWINE_X64
+    // jmpReg uses PEXT and SHRX when the host has them
+    if (x64CPU::hasBMI2) {
+        result |= 0x200;
+    }
+#endif
+    return result;
+}
+
+// the translator appends the next block when it runs off the end of one, this does the same so that an op index from
+// the previous run finds the same op
+static DecodedOp* getOpAtIndex(BtCPU* cpu, DecodedBlock* block, U32 index) {
+    DecodedOp* op = block->op;
+    DecodedOp* prev = nullptr;
+    U32 address = block->address;
+
+    for (U32 i = 0; op; i++) {
+        if (i == index) {
+            return op;
+        }
+        address += op->len;
+        prev = op;
+        op = op->next;
+        if (!op) {
+            DecodedBlock* next = NormalCPU::getBlockForInspectionButNotUsed(cpu, address, cpu->isBig());
+            block->bytes += next->bytes;
+            prev->next = next->op;
+            block->clearNeededFlagsCache();
+            next->op = nullptr;
+            next->dealloc(false);
+            op = prev->next;
+        }
+    }
+    return nullptr;
+}
+
+static bool getOpIndex(DecodedBlock* block, DecodedOp* op, U32& index) {
+    DecodedOp* next = block->op;
+
+    for (U32 i = 0; next && i < CHUNK_STORE_MAX_LEN; i++, next = next->next) {
+        if (next == op) {
+            index = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void addStoredChunk(const std::shared_ptr<StoredChunk>& chunk) {
+    std::shared_ptr<StoredChunk> head;
+    storedChunks.get(chunk->record.address, head);
+    chunk->next = head;
+    storedChunks.set(chunk->record.address, chunk);
+}
+
+static bool isValidRecord(const ChunkStoreRecord& record) {
+    return record.magic == CHUNK_STORE_MAGIC && record.guestLen <= CHUNK_STORE_MAX_LEN && record.eipLen <= record.guestLen && record.instructionCount <= record.eipLen && record.hostLen <= CHUNK_STORE_MAX_LEN * 16 && record.relocationCount <= CHUNK_STORE_MAX_LEN && record.len == sizeof(ChunkStoreRecord) + StoredChunk::getDataLen(record);
+}
+
+// only the record headers are kept, the rest is read by readChunkData when a chunk at that address is needed
+static void indexRecords(U64 len) {
+    std::vector<U8> buffer;
+    U64 bufferPos = 0; // file offset of buffer[0]
+    U64 pos = sizeof(ChunkStoreHeader);
+
+    while (pos + sizeof(ChunkStoreRecord) <= len) {
+        if (pos < bufferPos || pos + sizeof(ChunkStoreRecord) > bufferPos + buffer.size()) {
+            U32 readLen = (U32)std::min((U64)CHUNK_STORE_READ_SIZE, len - pos);
+            buffer.resize(readLen);
+            bufferPos = pos;
+            if (lseek64(storeHandle, pos, SEEK_SET) != (S64)pos || (U32)::read(storeHandle, buffer.data(), readLen) != readLen) {
+                break;
+            }
+        }
+        std::shared_ptr<StoredChunk> chunk = std::make_shared<StoredChunk>();
+        ChunkStoreRecord& record = chunk->record;
+        memcpy(&record, buffer.data() + (pos - bufferPos), sizeof(ChunkStoreRecord));
+        if (!isValidRecord(record) || pos + record.len > len) {
+            break; // the last write of a run that didn't finish
+        }
+        chunk->offset = pos + sizeof(ChunkStoreRecord);
+        if (record.build == buildId) {
+            addStoredChunk(chunk);
+        }
+        pos += record.len;
+    }
+}
+
+// caller must hold storeMutex
+static bool readChunkData(const std::shared_ptr<StoredChunk>& chunk, std::vector<U8>& data) {
+    if (chunk->data.size()) {
+        data = chunk->data;
+        return true;
+    }
+    U32 len = (U32)StoredChunk::getDataLen(chunk->record);
+    data.resize(len);
+    return storeHandle >= 0 && lseek64(storeHandle, chunk->offset, SEEK_SET) == (S64)chunk->offset && (U32)::read(storeHandle, data.data(), len) == len && getDataCrc(data.data(), len) == chunk->record.crc;
+}
+
+// caller must hold storeMutex
+static void openStore() {
+    if (storeOpened) {
+        return;
+    }
+    storeOpened = true;
+    buildId = getBuildId();
+
+    BString path = KSystem::codeCachePath.stringByApppendingPath("chunks.bin");
+    ChunkStoreHeader header = {};
+    header.magic = CHUNK_STORE_MAGIC;
+    header.version = CHUNK_STORE_VERSION;
+
+    // O_APPEND so that another instance sharing the store can't overwrite what this one wrote
+    storeHandle = ::open(path.c_str(), O_RDWR | O_APPEND | O_BINARY);
+    if (storeHandle >= 0) {
+        ChunkStoreHeader existing = {};
+        storeSize = (U64)lseek64(storeHandle, 0, SEEK_END);
+        if (storeSize >= sizeof(ChunkStoreHeader) && storeSize < CHUNK_STORE_MAX_SIZE && lseek64(storeHandle, 0, SEEK_SET) == 0 && ::read(storeHandle, &existing, sizeof(ChunkStoreHeader)) == sizeof(ChunkStoreHeader) && !memcmp(&existing, &header, sizeof(ChunkStoreHeader))) {
+            indexRecords(storeSize);
+            return;
+        }
+        ::close(storeHandle);
+        storeHandle = -1;
+    }
+
+    // new file, a different format or it got too big.  Another instance might still be reading or appending to the old
+    // one, so it is replaced with a rename instead of being truncated
+    BString tmpPath = path;
+    tmpPath += ".";
+    tmpPath += BString::valueOf(KSystem::getSystemTimeAsMicroSeconds(), 16);
+    tmpPath += ".tmp";
+    storeHandle = ::open(tmpPath.c_str(), O_RDWR | O_CREAT | O_EXCL | O_APPEND | O_BINARY, 0666);
+    if (storeHandle < 0) {
+        klog_fmt("could not create code cache %s: %s", tmpPath.c_str(), strerror(errno));
+        return;
+    }
+    if (::write(storeHandle, &header, sizeof(ChunkStoreHeader)) != sizeof(ChunkStoreHeader)) {
+        ::close(storeHandle);
+        storeHandle = -1;
+        ::unlink(tmpPath.c_str());
+        return;
+    }
+#ifdef BOXEDWINE_MSVC
+    // rename won't replace an existing file on Windows
+    ::unlink(path.c_str());
+#endif
+    if (::rename(tmpPath.c_str(), path.c_str()) != 0) {
+        klog_fmt("could not replace code cache %s: %s", path.c_str(), strerror(errno));
+        ::close(storeHandle);
+        storeHandle = -1;
+        ::unlink(tmpPath.c_str());
+        return;
+    }
+    storeSize = sizeof(ChunkStoreHeader);
+}
+
+// caller must hold storeMutex
+static void flushPendingWrites() {
+    if (storeHandle >= 0 && pendingWrites.size()) {
+        U32 len = (U32)pendingWrites.size();
+        if ((U32)::write(storeHandle, pendingWrites.data(), len) == len) {
+            storeSize += len;
+            // with O_APPEND another instance might have written first, the file position is the end of this write
+            U64 start = (U64)lseek64(storeHandle, 0, SEEK_CUR) - len;
+            for (auto& chunk : pendingChunks) {
+                chunk->offset += start;
+                chunk->data.clear();
+                chunk->data.shrink_to_fit();
+            }
+        }
+    }
+    pendingWrites.clear();
+    pendingChunks.clear();
+}
+
+bool BtChunkStore::load(BtCPU* cpu, U32 ip, BtData* data) {
+    if (KSystem::codeCachePath.isEmpty() || !cpu->canStoreChunks()) {
+        return false;
+    }
+    U32 address = cpu->seg[CS].address + ip;
+    std::shared_ptr<StoredChunk> chunk;
+    {
+        BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(storeMutex);
+        openStore();
+        storedChunks.get(address, chunk);
+    }
+    U32 flags = getTranslationFlags(cpu);
+    std::vector<U8> guest;
+    StoredChunk loaded;
+
+    // the guest memory is read without storeMutex, reading it can take KMemory::mutex and save is called with that held
+    for (; chunk; chunk = chunk->next) {
+        ChunkStoreRecord& record = chunk->record;
+        if (record.csAddress != cpu->seg[CS].address || record.flags != flags || !cpu->memory->canRead(address, record.guestLen)) {
+            continue;
+        }
+        {
+            BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(storeMutex);
+            if (!readChunkData(chunk, loaded.data)) {
+                continue;
+            }
+        }
+        loaded.record = record;
+        guest.resize(record.guestLen);
+        cpu->memory->memcpy(guest.data(), address, record.guestLen);
+        if (!memcmp(guest.data(), loaded.guest(), record.guestLen)) {
+            break;
+        }
+    }
+    if (!chunk) {
+        return false;
+    }
+    ChunkStoreRecord& record = loaded.record;
+    KMemoryData* mem = getMemData(cpu->memory);
+
+    // a translation stops at code that is already translated and doesn't happen all at once for code that changes often
+    if (cpu->memory->findCodeBlockContaining(address, record.eipLen) || mem->codeCache.isAddressDynamic(address, record.eipLen)) {
+        return false;
+    }
+    data->startOfDataIp = ip;
+    data->startOfOpIp = ip;
+    data->ip = ip + record.eipLen;
+    data->done = true;
+    for (U32 i = 0; i < record.instructionCount; i++) {
+        data->mapAddress(address + loaded.eipOffsets()[i], loaded.hostOffsets()[i]);
+    }
+    U8* host = loaded.host();
+    for (U32 i = 0; i < record.hostLen; i++) {
+        data->write8(host[i]);
+    }
+    data->currentBlock = NormalCPU::getBlockForInspectionButNotUsed(cpu, address, cpu->isBig());
+
+    ChunkStoreRelocation* relocations = loaded.relocations();
+    for (U32 i = 0; i < record.relocationCount; i++) {
+        ChunkStoreRelocation& relocation = relocations[i];
+        U64 value = 0;
+
+        if (relocation.pos + 8 > record.hostLen) {
+            cpu->discardChunk(data);
+            return false;
+        }
+        if (relocation.type == BT_RELOCATION_IMAGE) {
+            value = (U64)imageAnchor + relocation.value;
+        } else if (relocation.type == BT_RELOCATION_OP) {
+            if (relocation.value) {
+                value = (U64)getOpAtIndex(cpu, data->currentBlock, (U32)relocation.value - 1);
+                if (!value) {
+                    cpu->discardChunk(data);
+                    return false;
+                }
+            }
+        } else if (relocation.type == BT_RELOCATION_BLOCK) {
+            value = (U64)data->currentBlock + relocation.value;
+        } else {
+            cpu->discardChunk(data);
+            return false;
+        }
+        data->write64Buffer(data->buffer + relocation.pos, value);
+    }
+    loadedChunks++;
+    return true;
+}
+
+void BtChunkStore::save(BtCPU* cpu, BtData* data, std::shared_ptr<BtCodeChunk>& chunk) {
+    if (KSystem::codeCachePath.isEmpty() || !cpu->canStoreChunks() || data->superblock || !chunk->getEipLen() || !chunk->block) {
+        return;
+    }
+    for (auto& relocation : data->relocations) {
+        if (relocation.type == BT_RELOCATION_NONE) {
+            return;
+        }
+    }
+    U32 address = chunk->getEip();
+    DecodedBlock* block = chunk->block;
+    KMemoryData* mem = getMemData(cpu->memory);
+    std::shared_ptr<StoredChunk> stored = std::make_shared<StoredChunk>();
+    ChunkStoreRecord& record = stored->record;
+
+    record.magic = CHUNK_STORE_MAGIC;
+    record.address = address;
+    record.csAddress = cpu->seg[CS].address;
+    record.flags = getTranslationFlags(cpu);
+    record.eipLen = chunk->getEipLen();
+    // the flags the code needs can depend on ops past the end of the chunk that were decoded with it
+    record.guestLen = std::max(record.eipLen, block->bytes);
+    record.instructionCount = data->ipAddressCount;
+    record.hostLen = chunk->getHostAddressLen();
+    record.relocationCount = (U32)data->relocations.size();
+    if (record.guestLen > CHUNK_STORE_MAX_LEN || !cpu->memory->canRead(address, record.guestLen) || mem->codeCache.isAddressDynamic(address, record.eipLen)) {
+        return;
+    }
+    U64 dataLen = StoredChunk::getDataLen(record);
+    record.len = (U32)(sizeof(ChunkStoreRecord) + dataLen);
+    stored->data.resize((size_t)dataLen);
+
+    cpu->memory->memcpy(stored->guest(), address, record.guestLen);
+    for (U32 i = 0; i < record.instructionCount; i++) {
+        stored->eipOffsets()[i] = data->ipAddress[i] - address;
+        stored->hostOffsets()[i] = data->ipAddressBufferPos[i];
+    }
+    // the linked code, jumps within the chunk are relative so they don't need to be relocated
+    memcpy(stored->host(), chunk->getHostAddress(), record.hostLen);
+    for (U32 i = 0; i < record.relocationCount; i++) {
+        ChunkStoreRelocation& relocation = stored->relocations()[i];
+        U64 value = 0;
+        relocation.pos = data->relocations[i].bufferPos;
+        relocation.type = data->relocations[i].type;
+        memcpy(&value, stored->host() + relocation.pos, 8);
+
+        if (relocation.type == BT_RELOCATION_IMAGE) {
+            relocation.value = value - (U64)imageAnchor;
+            // something in a shared library, it can move independently of the executable
+            if ((S64)relocation.value < -0x80000000ll || (S64)relocation.value > 0x80000000ll) {
+                return;
+            }
+        } else if (relocation.type == BT_RELOCATION_OP) {
+            U32 index = 0;
+            if (value && !getOpIndex(block, (DecodedOp*)value, index)) {
+                return;
+            }
+            relocation.value = value ? index + 1 : 0;
+        } else if (relocation.type == BT_RELOCATION_BLOCK) {
+            relocation.value = value - (U64)block;
+            if (relocation.value >= sizeof(DecodedBlock)) {
+                return;
+            }
+        } else {
+            return;
+        }
+    }
+
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(storeMutex);
+    openStore();
+    if (storeHandle < 0 || storeSize + pendingWrites.size() + record.len > CHUNK_STORE_MAX_SIZE) {
+        return;
+    }
+    std::shared_ptr<StoredChunk> existing;
+    std::vector<U8> existingData;
+    storedChunks.get(address, existing);
+    for (; existing; existing = existing->next) {
+        // the same code translated again, for example after the page was written to
+        if (existing->record.csAddress == record.csAddress && existing->record.flags == record.flags && existing->record.guestLen == record.guestLen && readChunkData(existing, existingData) && !memcmp(existingData.data(), stored->guest(), record.guestLen)) {
+            return;
+        }
+    }
+    record.build = buildId;
+    record.crc = getDataCrc(stored->data.data(), dataLen);
+    addStoredChunk(stored);
+
+    size_t pos = pendingWrites.size();
+    stored->offset = pos + sizeof(ChunkStoreRecord); // relative to pendingWrites until it is written
+    pendingChunks.push_back(stored);
+    pendingWrites.resize(pos + record.len);
+    memcpy(pendingWrites.data() + pos, &record, sizeof(ChunkStoreRecord));
+    memcpy(pendingWrites.data() + pos + sizeof(ChunkStoreRecord), stored->data.data(), (size_t)dataLen);
+    if (pendingWrites.size() >= CHUNK_STORE_WRITE_SIZE) {
+        flushPendingWrites();
+    }
+}
+
+void BtChunkStore::shutdown() {
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(storeMutex);
+    flushPendingWrites();
+    if (storeHandle >= 0) {
+        ::close(storeHandle);
+        storeHandle = -1;
+    }
+    storedChunks.clear();
+    storeOpened = false;
+}
+
+#endif
@@ -0,0 +1,47 @@
+/*
+ *  Copyright (C) 2012-2025  The BoxedWine Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef __BT_CHUNK_STORE_H__
+#define __BT_CHUNK_STORE_H__
+
+#ifdef BOXEDWINE_BINARY_TRANSLATOR
+
+class BtCPU;
+class BtData;
+class BtCodeChunk;
+
+// Translated chunks kept between runs, see KSystem::codeCachePath.  A stored chunk is only used again at the same
+// address, with the same guest bytes and with the same process settings that the translator looked at.  The host
+// addresses in the code (functions, DecodedOps, etc) are relocated when it is loaded.
+class BtChunkStore {
+public:
+    // fills data like a translation would have, returns false if nothing was stored for this code
+    static bool load(BtCPU* cpu, U32 ip, BtData* data);
+
+    // data must be what was just published as chunk, caller must hold KMemory::mutex
+    static void save(BtCPU* cpu, BtData* data, std::shared_ptr<BtCodeChunk>& chunk);
+
+    // writes out anything still pending, the store will be read again on the next load
+    static void shutdown();
+
+    static std::atomic<U32> loadedChunks;
+};
+
+#endif
+
+#endif
@@ -28,7 +28,7 @@ BtCodeChunk::BtCodeChunk(U32 instructionCount, U32* eipInstructionAddress, U32*
     this->instructionCount = instructionCount;
     this->emulatedAddress = eip + cpu->seg[CS].address;
     this->emulatedLen = eipLen;
-    this->hostAddress = getMemData(cpu->memory)->allocateExcutableMemory(hostInstructionBufferLen + 4, &this->hostAddressSize); // +4 for a guard
+    this->hostAddress = getMemData(cpu->memory)->allocateExcutableMemory(hostInstructionBufferLen + 4, &this->hostAddressSize, this); // +4 for a guard
     this->hostLen = hostInstructionBufferLen;
     this->emulatedInstructionLen = new U8[instructionCount];
     this->hostInstructionLen = new U32[instructionCount];
@@ -60,18 +60,7 @@ void BtCodeChunk::makeLive() {
         KMemoryData* mem = getMemData(cpu->memory);
 
         for (U32 i = 0; i < instructionCount; i++) {
-            U32 page = eip >> K_PAGE_SHIFT;
-            U32 offset = eip & K_PAGE_MASK;
-            U8** table = mem->eipToHostInstructionPages[page];
-            if (!table) {
-                table = new U8* [K_PAGE_SIZE];
-                memset(table, 0, sizeof(U8*) * K_PAGE_SIZE);
-                mem->eipToHostInstructionPages[page] = table;
-            }
-            if (table[offset]) {
-                kpanic("BtCodeChunk::allocChunk eip already mapped");
-            }
-            table[offset] = host;
+            mem->setHostAddress(eip, host);
             eip += this->emulatedInstructionLen[i];
             host += this->hostInstructionLen[i];
         }
@@ -90,8 +79,10 @@ void BtCodeChunk::detachFromHost(KMemory* memory) {
     }
 
     for (U32 i = 0; i < this->instructionCount; i++) {
-        if (mem->eipToHostInstructionPages[eip >> K_PAGE_SHIFT]) { // might span multiple pages and the other pages are already deleted
-            mem->eipToHostInstructionPages[eip >> K_PAGE_SHIFT][eip & K_PAGE_MASK] = nullptr;
+        // a superblock can overlap a chunk that it only partly covers, the overlapping eips belong to whichever was
+        // made live last
+        if (this->containsHostAddress((U8*)mem->getExistingHostAddress(eip))) {
+            mem->clearHostAddress(eip);
         }
 
         if (i + 1 < this->instructionCount) {
@@ -168,16 +159,6 @@ U32 BtCodeChunk::getStartOfInstructionByEip(U32 eip, U8** host, U32* index) {
     return 0;
 }
 
-std::shared_ptr<BtCodeChunkLink> BtCodeChunk::addLinkFrom(std::shared_ptr<BtCodeChunk>& from, U32 toEip, U8* toHostInstruction, U8* fromHostOffset, bool direct) {
-    if (from == shared_from_this()) {
-        kpanic("BtCodeChunk::addLinkFrom can not link to itself");
-    }
-    std::shared_ptr<BtCodeChunkLink> link = std::make_shared<BtCodeChunkLink>(fromHostOffset, toEip, from->getEip(), toHostInstruction, direct);
-    from->linksTo.push_back(link);
-    this->linksFrom.push_back(link);
-    return link;
-}
-
 void BtCodeChunk::releaseAndRetranslate() {
     // remove this chunk and its mappings from being used (since it is about to be replaced)
     BtCPU* cpu = (BtCPU*)KThread::currentThread()->cpu;
@@ -186,30 +167,59 @@ void BtCodeChunk::releaseAndRetranslate() {
     mem->memory->removeCodeBlock(getEip(), getEipLen());    
     std::shared_ptr<BtCodeChunk> chunk = cpu->translateChunk(this->emulatedAddress - cpu->seg[CS].address);
     cpu->makePendingCodePagesReadOnly();
-    for (auto& link : this->linksFrom) {
-        U64 destHost = (U64)chunk->getHostFromEip(link->toEip);
+#ifdef BOXEDWINE_4K_PAGE_SIZE
+    chunk->exceptionCount = this->exceptionCount;
+#endif
+    chunk->makeLive();
 
-        if (destHost) {
-            chunk->linksFrom.push_back(link);
-            if (link->direct) {                
-                std::shared_ptr<BtCodeChunk> fromChunk = cpu->memory->findCodeBlockContaining(link->fromEip, 1);
-                U8* srcHostInstruction = nullptr;
-                U32 fromInstructionIndex = 0;
-                fromChunk->getEipThatContainsHostAddress(link->fromHostOffset, &srcHostInstruction, &fromInstructionIndex);
-                U64 srcHost = (U64)srcHostInstruction;
-                U64 endOfJump = (U64)link->fromHostOffset - srcHost + 4;
-                *((U32*)link->fromHostOffset) = (U32)(destHost - srcHost - endOfJump);
-            } else {
-                ATOMIC_WRITE64((U64*)&link->toHostInstruction, destHost);
-            }
+    this->internalDealloc(); // don't call dealloc() because the new chunk occupies the memory cache and we don't want to mess with it
+}
+
+// the chunk has run enough to be worth translating again as a superblock.  The superblock replaces every chunk it fully
+// covers, including this one.  A chunk it only partly covers stays live, the eips after the superblock and anything that
+// jumps to them still need it.  Jumps are only linked within a chunk, a jump to another chunk looks up the eip, so once
+// the covered chunks are unmapped nothing will enter them again.
+void BtCodeChunk::replaceWithSuperblock() {
+    BtCPU* cpu = (BtCPU*)KThread::currentThread()->cpu;
+    KMemoryData* mem = getMemData(cpu->memory);
+    std::shared_ptr<BtCodeChunk> chunk = cpu->publishChunk(cpu->translateChunkPrivate(this->emulatedAddress - cpu->seg[CS].address, true));
+    U32 start = chunk->getEip();
+    U32 end = start + chunk->getEipLen();
+    std::vector<std::shared_ptr<BtCodeChunk>> covered;
+
+    chunk->superblock = true;
+    for (U32 eip = start; eip < end;) {
+        std::shared_ptr<BtCodeChunk> existing = mem->getCodeChunkContainingEip(eip);
+        if (!existing || existing->getEip() + existing->getEipLen() <= eip) {
+            eip++;
+            continue;
+        }
+        if (existing->getEip() >= start && existing->getEip() + existing->getEipLen() <= end) {
+            covered.push_back(existing);
         }
-    };
+        eip = existing->getEip() + existing->getEipLen();
+    }
+    U32 epoch = mem->retireEpoch;
+    for (auto& existing : covered) {
+        existing->retire(epoch);
+        // only this chunk, anything that overlaps it and isn't covered stays in the cache so that writes still find it
+        mem->codeCache.removeCode(existing);
+    }
+    mem->retireEpoch++;
 #ifdef BOXEDWINE_4K_PAGE_SIZE
     chunk->exceptionCount = this->exceptionCount;
 #endif
     chunk->makeLive();
+}
 
-    this->internalDealloc(); // don't call dealloc() because the new chunk occupies the memory cache and we don't want to mess with it
+// other threads might still be running this chunk, so unlike releaseAndRetranslate its host code is left as is, the chunk
+// is only unmapped and kept alive by BtMemory until BtMemory::freeRetiredCodeChunks
+void BtCodeChunk::retire(U32 epoch) {
+    KMemoryData* mem = getMemData(KThread::currentThread()->memory);
+
+    this->retired = true;
+    mem->retiredCodeChunks.push_back(BtMemory::RetiredCodeChunk(shared_from_this(), epoch));
+    detachFromHost(KThread::currentThread()->memory);
 }
 
 void BtCodeChunk::clearInstructionCache(U8* hostAddress, U32 len) {
@@ -21,19 +21,6 @@
 
 #ifdef BOXEDWINE_BINARY_TRANSLATOR
 
-class BtCodeChunkLink {
-public:
-    BtCodeChunkLink(U8* fromHostOffset, U32 toEip, U32 fromEip, U8* toHostInstruction, bool direct) : fromHostOffset(fromHostOffset), toEip(toEip), fromEip(fromEip), toHostInstruction(toHostInstruction), direct(direct) {}
-    // will point to an address in the middle of the instruction
-    U8* fromHostOffset;
-
-    // will point to the start of the instruction
-    U32 toEip;
-    U32 fromEip;
-    U8* toHostInstruction;
-    bool direct;
-};
-
 class BtCPU;
 class DecodedBlock;
 
@@ -45,8 +32,10 @@ public:
 
     void release(KMemory* memory);
     void releaseAndRetranslate();
+    void replaceWithSuperblock();
     void invalidateStartingAt(U32 eipAddress);
     void makeLive();
+    void internalDealloc();
 
     U32 getEipThatContainsHostAddress(U8* hostAddress, U8** startOfHostInstruction, U32* index);
 
@@ -57,14 +46,14 @@ public:
     bool containsEip(U32 eip) { return eip >= this->emulatedAddress && eip < this->emulatedAddress + this->emulatedLen; }
     bool containsEip(U32 eip, U32 len);
 
-    std::shared_ptr<BtCodeChunkLink> addLinkFrom(std::shared_ptr<BtCodeChunk>& from, U32 toEip, U8* toHostInstruction, U8* fromHostOffset, bool direct);
-
     U8* getHostFromEip(U32 eip) { U8* result = nullptr; if (this->getStartOfInstructionByEip(eip, &result, nullptr) == eip) { return result; } else { return nullptr; } }
     U32 getEip() { return emulatedAddress; }
     U32 getEipLen() { return emulatedLen; }
     U32 getStartOfInstructionByEip(U32 eip, U8** hostAddress, U32* index);
     
     DecodedBlock* block;
+    bool superblock = false;
+    bool retired = false; // replaced by a superblock, see BtMemory::retiredCodeChunks
 #ifdef BOXEDWINE_4K_PAGE_SIZE
     U32 startTimeForExceptionTracking = 0;
     U32 exceptionCount = 0;
@@ -72,7 +61,7 @@ public:
 #endif
 protected:
     void detachFromHost(KMemory* memory);
-    void internalDealloc();
+    void retire(U32 epoch);
     virtual void clearInstructionCache(U8* hostAddress, U32 len);
 
     U32 emulatedAddress;
@@ -85,9 +74,6 @@ protected:
     U32* hostInstructionLen;
 
     U32 instructionCount;
-
-    std::list<std::shared_ptr<BtCodeChunkLink>> linksTo;
-    std::list<std::shared_ptr<BtCodeChunkLink>> linksFrom;
 };
 
 #endif
@@ -20,6 +20,7 @@
 #include "btCodeChunk.h"
 #include "btCpu.h"
 #include "btData.h"
+#include "btChunkStore.h"
 #include "ksignal.h"
 #include "knativethread.h"
 #include "knativesystem.h"
@@ -34,6 +35,7 @@ typedef void (*StartCPU)();
 void BtCPU::run() {
     while (true) {
         this->exitToStartThreadLoop = 0;
+        leftTranslatedCode();
         StartCPU start = (StartCPU)this->init();
         start();
 #ifdef __TEST
@@ -64,14 +66,18 @@ void BtCPU::run() {
     }
 }
 
-std::shared_ptr<BtCodeChunk> BtCPU::translateChunk(U32 ip) {
+// decodes and emits into this cpu's own BtData buffers and DecodedBlocks, nothing shared with other threads is changed
+// until publishChunk, so this doesn't need KMemory::mutex
+BtData* BtCPU::translateChunkPrivate(U32 ip, bool superblock) {
     BtData* firstPass = getData1();
+    firstPass->superblock = superblock;
     firstPass->ip = ip;
     firstPass->startOfDataIp = ip;
     firstPass->startOfOpIp = ip; // in case first op is dynamic (F-16 on x64 with 4k page option can trigger this)
     translateData(firstPass);
 
     BtData* secondPass = getData2();
+    secondPass->superblock = superblock;
     secondPass->ip = ip;
     secondPass->startOfDataIp = ip;
     secondPass->startOfOpIp = ip;
@@ -79,31 +85,65 @@ std::shared_ptr<BtCodeChunk> BtCPU::translateChunk(U32 ip) {
     translateData(secondPass, firstPass);
     S32 failedJumpOpIndex = this->preLinkCheck(secondPass);
 
-    if (failedJumpOpIndex == -1) {
-        std::shared_ptr<BtCodeChunk> chunk = secondPass->commit(false);
-        link(secondPass, chunk);
-        return chunk;
-    }
-    else {
+    if (failedJumpOpIndex != -1) {
+        discardChunk(firstPass);
+        discardChunk(secondPass);
+
         firstPass->reset();
+        firstPass->superblock = superblock;
         firstPass->ip = ip;
         firstPass->startOfDataIp = ip;
         firstPass->stopAfterInstruction = failedJumpOpIndex;
         translateData(firstPass);
 
         secondPass->reset();
+        secondPass->superblock = superblock;
         secondPass->ip = ip;
         secondPass->startOfDataIp = ip;
         secondPass->calculatedEipLen = firstPass->ip - firstPass->startOfDataIp;
         secondPass->stopAfterInstruction = failedJumpOpIndex;
         translateData(secondPass, firstPass);
+    }
+    // the second pass decoded its own block, that is the one the chunk will keep
+    discardChunk(firstPass);
+    return secondPass;
+}
+
+// The guest eips the translation decoded, a superblock can follow calls and jumps so this isn't always
+// [startOfDataIp, ip)
+void BtCPU::getTranslatedRange(BtData* data, U32& start, U32& len) {
+    U32 end = data->ip;
+
+    start = data->startOfDataIp;
+    for (U32 i = 0; i < data->ipAddressCount; i++) {
+        if (data->ipAddress[i] < start) {
+            start = data->ipAddress[i];
+        }
+        if (data->ipAddress[i] + K_MAX_X86_OP_LEN > end) {
+            end = data->ipAddress[i] + K_MAX_X86_OP_LEN;
+        }
+    }
+    len = end - start;
+}
 
-        std::shared_ptr<BtCodeChunk> chunk = secondPass->commit(false);
-        link(secondPass, chunk);
-        return chunk;
+// caller must hold KMemory::mutex
+std::shared_ptr<BtCodeChunk> BtCPU::publishChunk(BtData* data) {
+    std::shared_ptr<BtCodeChunk> chunk = data->commit(false);
+    link(data, chunk);
+    return chunk;
+}
+
+void BtCPU::discardChunk(BtData* data) {
+    if (data->currentBlock) {
+        data->currentBlock->dealloc(false);
+        data->currentBlock = nullptr;
     }
 }
 
+std::shared_ptr<BtCodeChunk> BtCPU::translateChunk(U32 ip) {
+    return publishChunk(translateChunkPrivate(ip));
+}
+
 U64 BtCPU::reTranslateChunk() {
     KMemoryData* mem = getMemData(memory);
 #ifndef __TEST
@@ -125,6 +165,43 @@ U64 BtCPU::reTranslateChunk() {
     return result;
 }
 
+// called by a tier 1 chunk once it has been entered enough times, eip is the start of the chunk
+// called from a stub that jumps to whatever is returned, so this thread isn't in any chunk while here
+U64 BtCPU::retranslateHotChunk() {
+    KMemoryData* mem = getMemData(memory);
+    U32 address = this->getEipAddress();
+    leftTranslatedCode();
+    // this takes KProcess::threadsMutex, so it is done before taking the memory mutex
+    U32 oldestEpoch = getOldestRetireEpoch();
+    {
+        BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(memory->mutex);
+        mem->freeRetiredCodeChunks(oldestEpoch);
+        std::shared_ptr<BtCodeChunk> chunk = mem->getCodeChunkContainingEip(address);
+        // another thread might have already replaced it
+        if (chunk && chunk->getEip() == address && !chunk->superblock) {
+            chunk->replaceWithSuperblock();
+        }
+    }
+    return getIpFromEip();
+}
+
+void BtCPU::leftTranslatedCode() {
+    this->retireEpoch = getMemData(memory)->retireEpoch.load();
+}
+
+U32 BtCPU::getOldestRetireEpoch() {
+    U32 result = getMemData(memory)->retireEpoch;
+
+    this->thread->process->iterateThreads([&result](KThread* thread) {
+        U32 epoch = ((BtCPU*)thread->cpu)->retireEpoch;
+        if (epoch < result) {
+            result = epoch;
+        }
+        return true;
+        });
+    return result;
+}
+
 static U8 fetchByte(void* p, U32* eip) {
     KMemory* memory = (KMemory*)p;
     return memory->readb((*eip)++);
@@ -156,17 +233,65 @@ void* BtCPU::translateEipInternal(U32 ip) {
     void* result = mem->getExistingHostAddress(address);
 
     if (!result) {
-        std::shared_ptr<BtCodeChunk> chunk = this->translateChunk(ip);
+        bool loaded = false;
+        BtData* data = loadOrTranslateChunkPrivate(ip, loaded);
+        std::shared_ptr<BtCodeChunk> chunk = publishChunk(data);
+        if (!loaded) {
+            BtChunkStore::save(this, data, chunk);
+        }
         result = chunk->getHostAddress();
         chunk->makeLive();
     }
     return result;
 }
 
+// code that is seen for the first time in this run might have been translated in a previous one.  Retranslations don't
+// use the chunk store, they happen because of something it doesn't know about.
+BtData* BtCPU::loadOrTranslateChunkPrivate(U32 ip, bool& loaded) {
+    BtData* data = getData2();
+    loaded = BtChunkStore::load(this, ip, data);
+    if (loaded) {
+        return data;
+    }
+    return translateChunkPrivate(ip);
+}
+
 void* BtCPU::translateEip(U32 ip) {
-    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(memory->mutex);
+    if (!this->isBig()) {
+        ip = ip & 0xFFFF;
+    }
+    U32 address = this->seg[CS].address + ip;
+    KMemoryData* mem = getMemData(memory);
+    void* result = mem->getExistingHostAddress(address);
+
+    if (!result) {
+        // translating is the slow part, do it without the mutex so that other threads can keep faulting, writing to
+        // code pages and making memory syscalls, then only hold it long enough to publish the chunk
+        U32 codeVersion = mem->codeVersion;
+        bool loaded = false;
+        BtData* data = loadOrTranslateChunkPrivate(ip, loaded);
+        U32 start = 0;
+        U32 len = 0;
+        getTranslatedRange(data, start, len);
 
-    void* result = translateEipInternal(ip);
+        BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(memory->mutex);
+        result = mem->getExistingHostAddress(address);
+        if (!result && !mem->hasCodeChanged(codeVersion, this->seg[CS].address + start, len)) {
+            std::shared_ptr<BtCodeChunk> chunk = publishChunk(data);
+            if (!loaded) {
+                BtChunkStore::save(this, data, chunk);
+            }
+            result = chunk->getHostAddress();
+            chunk->makeLive();
+        } else {
+            // another thread published code here or the guest memory it was decoded from changed while this was being
+            // translated
+            discardChunk(data);
+            if (!result) {
+                result = translateEipInternal(ip);
+            }
+        }
+    }
     makePendingCodePagesReadOnly();
     return result;
 }
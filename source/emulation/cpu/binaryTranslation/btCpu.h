@@ -53,15 +53,28 @@ public:
 #endif
     std::vector<U32> pendingCodePages;
 
+    // the BtMemory::retireEpoch this thread saw the last time it wasn't running translated code, chunks retired before
+    // that can't be running on this thread.  It is updated at the safe points where nothing will return into a chunk:
+    // translating, the hot chunk stub and single ops, which includes syscalls and so any blocking wait.
+    std::atomic<U32> retireEpoch = 0;
+    void leftTranslatedCode();
+
     std::shared_ptr<BtCodeChunk> translateChunk(U32 ip);
+    BtData* translateChunkPrivate(U32 ip, bool superblock = false);
+    std::shared_ptr<BtCodeChunk> publishChunk(BtData* data);
+    void getTranslatedRange(BtData* data, U32& start, U32& len);
+    void discardChunk(BtData* data);
     virtual void translateData(BtData* data, BtData* firstPass = nullptr) = 0;
     virtual void link(BtData* data, std::shared_ptr<BtCodeChunk>& fromChunk, U32 offsetIntoChunk = 0) = 0;
     void* translateEipInternal(U32 ip);
+    virtual bool canStoreChunks() { return false; } // true if the translator records its relocations, see BtChunkStore
 #ifdef __TEST
     virtual void postTestRun() = 0;
 #endif
 
     U64 reTranslateChunk();
+    U64 retranslateHotChunk();
+    U32 getOldestRetireEpoch();
     U64 handleMissingCode(U32 page, U32 offset);        
     DecodedOp* getOp(U32 eip, bool existing);
     void* translateEip(U32 ip);    
@@ -78,6 +91,7 @@ public:
     U32 pageOffsetJumpInstruction = 0;
 protected:
     U64 getIpFromEip();
+    BtData* loadOrTranslateChunkPrivate(U32 ip, bool& loaded);
     virtual BtData* getData1() = 0;
     virtual BtData* getData2() = 0;
 };
@@ -55,7 +55,9 @@ void BtData::reset() {
     this->stopAfterInstruction = -1;
     this->currentOp = nullptr;
     this->needLargeIfJmpReg = false;
+    this->superblock = false;
     todoJump.clear();
+    relocations.clear();
 }
 
 void BtData::write8(U8 data) {
@@ -153,6 +155,44 @@ void BtData::mapAddress(U32 ip, U32 bufferPos) {
     this->ipAddressBufferPos[this->ipAddressCount++] = bufferPos;
 }
 
+// called after an instruction that ended the chunk.  A superblock keeps going past a direct call, since it returns to
+// the next instruction, and past a direct jmp when an earlier branch in this chunk targets the next instruction, this
+// way those branches become jumps within the chunk instead of going through the eip to host lookup.
+bool BtData::continueSuperblock() {
+    if (!this->superblock || this->ipAddressCount >= BT_SUPERBLOCK_MAX_INSTRUCTIONS) {
+        return false;
+    }
+    if (this->firstPass) {
+        // the second pass has to end where the first one did
+        return this->ip - this->startOfDataIp < this->calculatedEipLen;
+    }
+    switch (this->currentOp->inst) {
+    case CallJw:
+    case CallJd:
+        return true;
+    case JmpJb:
+    case JmpJw:
+    case JmpJd:
+        // the first pass doesn't know the chunk length yet, so every direct branch is in todoJump
+        for (auto& jump : this->todoJump) {
+            if (jump.eip == this->ip) {
+                return true;
+            }
+        }
+        return false;
+    default:
+        return false;
+    }
+}
+
+// Flag liveness must not look at code that was decoded past the end of this chunk, see DecodedBlock::translatedEnd.  The
+// second pass knows where the chunk ends, the first pass only knows what it translated so far.
+void BtData::limitBlockToChunk(DecodedBlock* block) {
+    if (block) {
+        block->setTranslatedEnd(block->address + (calculatedEipLen ? calculatedEipLen : startOfOpIp + currentOp->len - startOfDataIp));
+    }
+}
+
 std::shared_ptr<BtCodeChunk> BtData::commit(bool makeLive) {
     std::shared_ptr<BtCodeChunk> chunk = createChunk(this->ipAddressCount, this->ipAddress, this->ipAddressBufferPos, this->buffer, this->bufferPos, this->startOfDataIp, this->ip - this->startOfDataIp, false);
     chunk->block = this->currentBlock;
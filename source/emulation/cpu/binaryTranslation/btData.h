@@ -23,6 +23,9 @@
 
 #include "btCpu.h"
 
+// a superblock won't grow past this many instructions
+#define BT_SUPERBLOCK_MAX_INSTRUCTIONS 256
+
 class TodoJump {
 public:
     TodoJump() = default;
@@ -32,6 +35,20 @@ public:
     U32 opIndex = 0;
 };
 
+#define BT_RELOCATION_IMAGE 1 // a function or static data in the executable
+#define BT_RELOCATION_OP 2 // a DecodedOp from the chunk's block
+#define BT_RELOCATION_BLOCK 3 // a field of the chunk's block
+#define BT_RELOCATION_NONE 4 // only valid for this run
+
+// a 64-bit host address that was written into the code, see BtChunkStore
+class BtRelocation {
+public:
+    BtRelocation() = default;
+    BtRelocation(U32 bufferPos, U32 type) : bufferPos(bufferPos), type(type) {}
+    U32 bufferPos = 0;
+    U32 type = 0;
+};
+
 class BtData {
 public:
     BtData();
@@ -55,6 +72,7 @@ public:
     U8 bufferInternal[512] = { 0 };
 
     std::vector<TodoJump> todoJump;
+    std::vector<BtRelocation> relocations;
     S32 stopAfterInstruction = -1;
 
     DecodedOp* currentOp = nullptr;
@@ -62,9 +80,13 @@ public:
 
     BtData* firstPass = nullptr;
     bool needLargeIfJmpReg = false;
+    bool superblock = false; // a hot chunk being translated again, see BtCPU::retranslateHotChunk
 
     void mapAddress(U32 ip, U32 bufferPos);
+    void addRelocation(U32 type) { relocations.push_back(BtRelocation(this->bufferPos - 8, type)); } // call right after writing the address
     U8 calculateEipLen(U32 eip);
+    bool continueSuperblock();
+    void limitBlockToChunk(DecodedBlock* block);
 
     void write8(U8 data);
     void write16(U16 data);
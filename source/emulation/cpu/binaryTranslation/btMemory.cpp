@@ -22,20 +22,53 @@
 #include "btMemory.h"
 #include "btCodeChunk.h"
 
-BtMemory::BtMemory(KMemory* memory) : memory(memory) {
-    this->eipToHostInstructionPages = new U8** [K_NUMBER_OF_PAGES];
-    memset(this->eipToHostInstructionPages, 0, K_NUMBER_OF_PAGES * sizeof(void**));
-    memset(this->committedEipPages, 0, sizeof(this->committedEipPages));
+#define K_EIP_PAGES_SIZE (K_NUMBER_OF_PAGES * sizeof(U8***))
+#define K_EXECUTABLE_INDEX_TOP_BYTES (K_EXECUTABLE_INDEX_TOP_SIZE * sizeof(void*))
+#define K_EXECUTABLE_INDEX_LEAF_BYTES (K_EXECUTABLE_INDEX_LEAF_SIZE * sizeof(void*))
+
+static U8* emptyEipSlice[K_EIP_SLICE_SIZE];
+
+std::atomic<U64> BtMemory::eipIndexBytes;
+
+BString BtMemory::getStats() {
+    BString result = B("eip index ");
+    result.append((U32)(eipIndexBytes.load() / 1024));
+    result.append("KB");
+    return result;
+}
+
+BtMemory::BtMemory(KMemory* memory) : memory(memory), retireEpoch(1), codeEpoch(1), codeVersion(0) {
+    // only the parts of these that are used will be backed by the host
+    this->eipToHostInstructionPages = (EipDirectoryPtr*)Platform::alloc64kBlock(K_EIP_PAGES_SIZE / (64 * 1024));
+    this->committedEipPages = (bool*)Platform::alloc64kBlock(K_NUMBER_OF_PAGES / (64 * 1024));
+    this->executableIndex = (AllocatedMemory***)Platform::alloc64kBlock(K_EXECUTABLE_INDEX_TOP_BYTES / (64 * 1024));
 }
 
 BtMemory::~BtMemory() {    
-    if (this->eipToHostInstructionPages) {
-        for (U32 i = 0; i < K_NUMBER_OF_PAGES; i++) {
-            if (this->eipToHostInstructionPages[i]) {
-                delete[] this->eipToHostInstructionPages[i];
+    for (U32 i = 0; i < K_NUMBER_OF_PAGES; i++) {
+        EipSlicePtr* directory = this->eipToHostInstructionPages[i].load(std::memory_order_acquire);
+        if (directory) {
+            for (U32 slice = 0; slice < K_EIP_SLICES_PER_PAGE; slice++) {
+                U8** entries = directory[slice].load(std::memory_order_acquire) + (slice << K_EIP_SLICE_SHIFT);
+                if (entries != emptyEipSlice) {
+                    delete[] entries;
+                    eipIndexBytes -= sizeof(U8*) * K_EIP_SLICE_SIZE;
+                }
             }
+            delete[] directory;
+            eipIndexBytes -= sizeof(U8**) * K_EIP_SLICES_PER_PAGE;
+        }
+    }
+    Platform::releaseNativeMemory(this->eipToHostInstructionPages, K_EIP_PAGES_SIZE);
+    Platform::releaseNativeMemory(this->committedEipPages, K_NUMBER_OF_PAGES);
+    for (U32 i = 0; i < K_EXECUTABLE_INDEX_TOP_SIZE; i++) {
+        if (this->executableIndex[i]) {
+            Platform::releaseNativeMemory(this->executableIndex[i], K_EXECUTABLE_INDEX_LEAF_BYTES);
         }
-        delete[] this->eipToHostInstructionPages;
+    }
+    Platform::releaseNativeMemory(this->executableIndex, K_EXECUTABLE_INDEX_TOP_BYTES);
+    for (auto& p : this->allocatedExecutableMemory) {
+        delete[] p.chunks;
     }
 }
 
@@ -43,19 +76,103 @@ BtMemory::~BtMemory() {
 U8* BtMemory::getExistingHostAddress(U32 eip) {
     U32 page = eip >> K_PAGE_SHIFT;
     U32 offset = eip & K_PAGE_MASK;
-    if (this->eipToHostInstructionPages[page])
-        return this->eipToHostInstructionPages[page][offset];
+    EipSlicePtr* directory = this->eipToHostInstructionPages[page].load(std::memory_order_acquire);
+    if (directory)
+        return directory[offset >> K_EIP_SLICE_SHIFT].load(std::memory_order_acquire)[offset];
     return nullptr;
 }
 
-bool BtMemory::isAddressExecutable(U8* address) {
-    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(mutex);
-    for (auto& p : this->allocatedExecutableMemory) {
-        if (address >= p.memory && address < p.memory + p.size) {
-            return true;
+void BtMemory::setHostAddress(U32 eip, U8* host) {
+    U32 page = eip >> K_PAGE_SHIFT;
+    U32 offset = eip & K_PAGE_MASK;
+    U32 slice = offset >> K_EIP_SLICE_SHIFT;
+    EipSlicePtr* directory = this->eipToHostInstructionPages[page].load(std::memory_order_acquire);
+
+    if (!directory) {
+        directory = new EipSlicePtr[K_EIP_SLICES_PER_PAGE];
+        for (U32 i = 0; i < K_EIP_SLICES_PER_PAGE; i++) {
+            directory[i].store(emptyEipSlice - (i << K_EIP_SLICE_SHIFT), std::memory_order_relaxed);
         }
+        eipIndexBytes += sizeof(U8**) * K_EIP_SLICES_PER_PAGE;
+        // the slices have to be visible before the directory is
+        this->eipToHostInstructionPages[page].store(directory, std::memory_order_release);
     }
-    return false;
+    U8** entries = directory[slice].load(std::memory_order_acquire) + (slice << K_EIP_SLICE_SHIFT);
+    if (entries == emptyEipSlice) {
+        entries = new U8* [K_EIP_SLICE_SIZE];
+        memset(entries, 0, sizeof(U8*) * K_EIP_SLICE_SIZE);
+        eipIndexBytes += sizeof(U8*) * K_EIP_SLICE_SIZE;
+        directory[slice].store(entries - (slice << K_EIP_SLICE_SHIFT), std::memory_order_release);
+    }
+    if (entries[offset & (K_EIP_SLICE_SIZE - 1)]) {
+        kpanic("BtCodeChunk::allocChunk eip already mapped");
+    }
+    entries[offset & (K_EIP_SLICE_SIZE - 1)] = host;
+}
+
+void BtMemory::clearHostAddress(U32 eip) {
+    U32 page = eip >> K_PAGE_SHIFT;
+    U32 offset = eip & K_PAGE_MASK;
+    EipSlicePtr* directory = this->eipToHostInstructionPages[page].load(std::memory_order_acquire);
+
+    // the shared empty slice is never written to, it is already null
+    if (directory) {
+        U8** entries = directory[offset >> K_EIP_SLICE_SHIFT].load(std::memory_order_acquire);
+        if (entries[offset]) {
+            entries[offset] = nullptr;
+        }
+    }
+}
+
+BtMemory::AllocatedMemory* BtMemory::getAllocatedMemory(U8* address) {
+    U64 page = (U64)address >> K_EXECUTABLE_INDEX_PAGE_SHIFT;
+    U64 top = page >> K_EXECUTABLE_INDEX_LEAF_BITS;
+
+    if (top >= K_EXECUTABLE_INDEX_TOP_SIZE) {
+        return nullptr;
+    }
+    AllocatedMemory** pages = this->executableIndex[top];
+    if (!pages) {
+        return nullptr;
+    }
+    return pages[page & K_EXECUTABLE_INDEX_LEAF_MASK];
+}
+
+// caller must hold mutex
+void BtMemory::addAllocatedMemory(AllocatedMemory* allocated) {
+    // the entry must be complete before a lock free reader can find it
+    std::atomic_thread_fence(std::memory_order_release);
+    for (U32 offset = 0; offset < allocated->size; offset += (1 << K_EXECUTABLE_INDEX_PAGE_SHIFT)) {
+        U64 page = (U64)(allocated->memory + offset) >> K_EXECUTABLE_INDEX_PAGE_SHIFT;
+        U64 top = page >> K_EXECUTABLE_INDEX_LEAF_BITS;
+
+        if (top >= K_EXECUTABLE_INDEX_TOP_SIZE) {
+            kpanic("BtMemory::addAllocatedMemory host address is larger than 48-bits");
+        }
+        AllocatedMemory** pages = this->executableIndex[top];
+        if (!pages) {
+            pages = (AllocatedMemory**)Platform::alloc64kBlock(K_EXECUTABLE_INDEX_LEAF_BYTES / (64 * 1024));
+            std::atomic_thread_fence(std::memory_order_release);
+            this->executableIndex[top] = pages;
+        }
+        pages[page & K_EXECUTABLE_INDEX_LEAF_MASK] = allocated;
+    }
+}
+
+bool BtMemory::isAddressExecutable(U8* address) {
+    return getAllocatedMemory(address) != nullptr;
+}
+
+U32 BtMemory::getEipFromHost(U8* host) {
+    AllocatedMemory* allocated = getAllocatedMemory(host);
+    if (!allocated) {
+        return 0;
+    }
+    BtCodeChunk* chunk = allocated->chunks[(host - allocated->memory) / allocated->chunkSize];
+    if (!chunk) {
+        return 0;
+    }
+    return chunk->getEipThatContainsHostAddress(host, nullptr, nullptr);
 }
 
 int powerOf2(U32 requestedSize, U32& size) {
@@ -68,7 +185,7 @@ int powerOf2(U32 requestedSize, U32& size) {
     return powerOf2Size;
 }
 
-U8* BtMemory::allocateExcutableMemory(U32 requestedSize, U32* allocatedSize) {
+U8* BtMemory::allocateExcutableMemory(U32 requestedSize, U32* allocatedSize, BtCodeChunk* owner) {
     BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(mutex);
     U32 size = 0;
     U32 powerOf2Size = powerOf2(requestedSize, size);
@@ -86,11 +203,15 @@ U8* BtMemory::allocateExcutableMemory(U32 requestedSize, U32* allocatedSize) {
     if (!this->freeExecutableMemory[index].empty()) {
         U8* result = this->freeExecutableMemory[index].front();
         this->freeExecutableMemory[index].pop_front();
+        AllocatedMemory* allocated = getAllocatedMemory(result);
+        allocated->chunks[(result - allocated->memory) / size] = owner;
         return result;
     }
     U32 count = (size + 65535) / 65536;
     U8* result = Platform::alloc64kBlock(count, true);
-    this->allocatedExecutableMemory.push_back(BtMemory::AllocatedMemory(result, count * 64 * 1024));
+    AllocatedMemory& allocated = this->allocatedExecutableMemory.emplace_back(result, count * 64 * 1024, size);
+    allocated.chunks[0] = owner;
+    addAllocatedMemory(&allocated);
     count = 65536 / size;
     for (U32 i = 1; i < count; i++) {
         this->freeExecutableMemory[index].push_back(((U8*)result) + size * i);
@@ -99,6 +220,10 @@ U8* BtMemory::allocateExcutableMemory(U32 requestedSize, U32* allocatedSize) {
 }
 
 void BtMemory::freeExcutableMemory(U8* hostMemory, U32 actualSize) {
+    AllocatedMemory* allocated = getAllocatedMemory(hostMemory);
+    if (allocated) {
+        allocated->chunks[(hostMemory - allocated->memory) / allocated->chunkSize] = nullptr;
+    }
     Platform::writeCodeToMemory(hostMemory, actualSize, [hostMemory, actualSize] {
         memset(hostMemory, 0xcd, actualSize);
         });
@@ -124,13 +249,53 @@ std::shared_ptr<BtCodeChunk> BtMemory::getCodeChunkContainingEip(U32 eip) {
 
 // called when BtCodeChunk is being dealloc'd
 void BtMemory::removeCodeChunk(const std::shared_ptr<BtCodeChunk>& chunk) {
-    
+    // the chunk's eip mappings have already been cleared
+    codeEpoch++;
+    codeChanged(chunk->getEip(), chunk->getEipLen());
 }
 
 // called when BtCodeChunk is being alloc'd
 void BtMemory::addCodeChunk(const std::shared_ptr<BtCodeChunk>& chunk) {
     BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(mutex);
     memory->addCodeBlock(chunk);
+    codeChanged(chunk->getEip(), chunk->getEipLen());
+}
+
+// caller must hold KMemory::mutex, oldestEpoch is the oldest BtCPU::retireEpoch of the threads using this memory
+void BtMemory::freeRetiredCodeChunks(U32 oldestEpoch) {
+    for (auto it = retiredCodeChunks.begin(); it != retiredCodeChunks.end();) {
+        if (it->epoch < oldestEpoch) {
+            it->chunk->internalDealloc();
+            it = retiredCodeChunks.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void BtMemory::codeChanged(U32 address, U32 len) {
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(codeChangesMutex);
+    U32 index = codeVersion & (BT_CODE_CHANGES - 1);
+    codeChangeAddress[index] = address;
+    codeChangeLen[index] = len;
+    codeVersion++;
+}
+
+// version is what codeVersion was before reading the guest memory in [address, address + len)
+bool BtMemory::hasCodeChanged(U32 version, U32 address, U32 len) {
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(codeChangesMutex);
+    U32 current = codeVersion;
+    if (current - version > BT_CODE_CHANGES) {
+        // the ranges that changed are no longer known
+        return true;
+    }
+    for (U32 v = version; v != current; v++) {
+        U32 index = v & (BT_CODE_CHANGES - 1);
+        if ((U64)address < (U64)codeChangeAddress[index] + codeChangeLen[index] && (U64)codeChangeAddress[index] < (U64)address + len) {
+            return true;
+        }
+    }
+    return false;
 }
 
 bool BtMemory::isEipPageCommitted(U32 page) {
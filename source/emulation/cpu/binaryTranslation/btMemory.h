@@ -25,16 +25,37 @@ class BtCodeChunk;
 
 #define K_MAX_X86_OP_LEN 15
 
+// how many code changes are remembered for BtMemory::hasCodeChanged, must be a power of 2
+#define BT_CODE_CHANGES 64
+
+#define K_EIP_SLICE_SHIFT 6 // each slice covers 64 bytes of emulated code
+#define K_EIP_SLICE_SIZE (1 << K_EIP_SLICE_SHIFT)
+#define K_EIP_SLICES_PER_PAGE (K_PAGE_SIZE >> K_EIP_SLICE_SHIFT)
+
+// host executable memory is indexed by host page (mmap doesn't promise 64k alignment) with a 2 level radix tree that
+// covers 48-bit host addresses
+#define K_EXECUTABLE_INDEX_PAGE_SHIFT 12
+#define K_EXECUTABLE_INDEX_TOP_BITS 16
+#define K_EXECUTABLE_INDEX_TOP_SIZE (1 << K_EXECUTABLE_INDEX_TOP_BITS)
+#define K_EXECUTABLE_INDEX_LEAF_BITS 20
+#define K_EXECUTABLE_INDEX_LEAF_SIZE (1 << K_EXECUTABLE_INDEX_LEAF_BITS)
+#define K_EXECUTABLE_INDEX_LEAF_MASK (K_EXECUTABLE_INDEX_LEAF_SIZE - 1)
+
 class BtMemory {
 public:	
 	BtMemory(KMemory* memory);
 	~BtMemory();	
 
 	U8* getExistingHostAddress(U32 eip);
-	U8* allocateExcutableMemory(U32 size, U32* allocatedSize);
+	void setHostAddress(U32 eip, U8* host);
+	void clearHostAddress(U32 eip);
+	U8* allocateExcutableMemory(U32 size, U32* allocatedSize, BtCodeChunk* owner);
 	void freeExcutableMemory(U8* hostMemory, U32 size);
 	void executableMemoryReleased();
+
+	// these are safe to call from an exception handler, they don't lock
 	bool isAddressExecutable(U8* address);
+	U32 getEipFromHost(U8* host);
 	bool isEipPageCommitted(U32 page);
 	void setEipPageCommitted(U32 page) { this->committedEipPages[page] = true; }		
 
@@ -45,9 +66,11 @@ public:
 
 	class AllocatedMemory {
 	public:
-		AllocatedMemory(U8* memory, U32 size) : memory(memory), size(size) {}
+		AllocatedMemory(U8* memory, U32 size, U32 chunkSize) : memory(memory), size(size), chunkSize(chunkSize), chunks(new BtCodeChunk* [size / chunkSize]()) {}
 		U8* memory;
 		U32 size;
+		U32 chunkSize;
+		BtCodeChunk** chunks; // size / chunkSize, the chunk that owns each piece of this memory
 	};
 	std::list<AllocatedMemory> allocatedExecutableMemory;
 
@@ -58,13 +81,62 @@ public:
 	std::list<U8*> freeExecutableMemory[EXECUTABLE_SIZES];		
 	KMemory* memory;
 
-	bool committedEipPages[K_NUMBER_OF_PAGES];
+	// chunks that were replaced by a superblock, another thread might still be running one so its host code and
+	// DecodedBlock have to stay around until every thread has left translated code since it was retired, see
+	// BtCPU::retireEpoch
+	class RetiredCodeChunk {
+	public:
+		RetiredCodeChunk(const std::shared_ptr<BtCodeChunk>& chunk, U32 epoch) : chunk(chunk), epoch(epoch) {}
+		std::shared_ptr<BtCodeChunk> chunk;
+		U32 epoch;
+	};
+	std::vector<RetiredCodeChunk> retiredCodeChunks;
+	std::atomic<U32> retireEpoch;
+	void freeRetiredCodeChunks(U32 oldestEpoch);
+
+	bool* committedEipPages; // K_NUMBER_OF_PAGES, only the parts that are used will be backed by the host
 
-	U8*** eipToHostInstructionPages;
+	// eipToHostInstructionPages[page] is null until code on that page is translated, then it is a directory of
+	// K_EIP_SLICES_PER_PAGE slices.  A slice pointer is stored minus (slice index * K_EIP_SLICE_SIZE) so that it can be
+	// indexed with the page offset, the translated code looks up directory[offset >> K_EIP_SLICE_SHIFT][offset].  Slices
+	// that don't have any translated code all point to one shared table of nulls.  Other threads look up a directory or
+	// slice while it is being published, so both are stored with release and loaded with acquire.  The translated code
+	// reads them as plain pointers.
+	typedef std::atomic<U8**> EipSlicePtr;
+	typedef std::atomic<EipSlicePtr*> EipDirectoryPtr;
+	static_assert(sizeof(EipSlicePtr) == sizeof(U8**) && sizeof(EipDirectoryPtr) == sizeof(U8***), "the translated code reads these as pointers");
+	EipDirectoryPtr* eipToHostInstructionPages;
 	BOXEDWINE_MUTEX mutex;
 
+	static BString getStats();
+	static std::atomic<U64> eipIndexBytes;
+
+	// bumped after any of this memory's eip to host mappings is removed, translated code caches host addresses outside
+	// of eipToHostInstructionPages (indirect jump caches, the return address predictor) and stamps them with this so
+	// that a stale entry is never used.  It starts at 1 so that a zeroed cache entry never matches.  A thread that
+	// changes its memory (exec) clears its caches instead, see x64CPU::init
+	std::atomic<U32> codeEpoch;
+
+	// bumped when translated code is published or removed and when the guest memory that code is decoded from changes,
+	// the last BT_CODE_CHANGES ranges are kept.  BtCPU::translateEip decodes and emits without holding KMemory::mutex
+	// and only publishes the result if none of the changes since it started overlap what it translated.
+	std::atomic<U32> codeVersion;
+	void codeChanged(U32 address, U32 len);
+	bool hasCodeChanged(U32 version, U32 address, U32 len);
+
 protected:
 	void clearCodePageFromCache(U32 page);
+
+	BOXEDWINE_MUTEX codeChangesMutex;
+	U32 codeChangeAddress[BT_CODE_CHANGES] = { 0 };
+	U32 codeChangeLen[BT_CODE_CHANGES] = { 0 };
+
+private:
+	AllocatedMemory* getAllocatedMemory(U8* address);
+	void addAllocatedMemory(AllocatedMemory* allocated);
+
+	// executableIndex[top][page] points into allocatedExecutableMemory, entries are only added while holding mutex
+	AllocatedMemory*** executableIndex;
 };
 
 #endif
@@ -184,10 +184,7 @@ void common_verw(CPU* cpu, U32 selector){
     cpu->verw(selector);
 }
 
-#ifdef BOXEDWINE_MULTI_THREADED
-void common_cmpxchg8b_lock(CPU* cpu, U32 address) {    
-    BOXEDWINE_CRITICAL_SECTION;
-
+void common_cmpxchg8b(CPU* cpu, U32 address){
     U64 value1 = ((U64)EDX) << 32 | EAX;
     U64 value2 = cpu->memory->readq(address);
     cpu->fillFlags();
@@ -200,15 +197,21 @@ void common_cmpxchg8b_lock(CPU* cpu, U32 address) {
         EDX = (U32)(value2 >> 32);
         EAX = (U32)value2;
     }
-    /*
+}
+
+#ifdef BOXEDWINE_MULTI_THREADED
+void common_cmpxchg8b_lock(CPU* cpu, U32 address) {
+    LockData64* p = (LockData64*)cpu->memory->getLockPtr(address, 8);
+    if (!p) {
+        KMemoryStripeLock lock(address, 8);
+        common_cmpxchg8b(cpu, address);
+        return;
+    }
+    std::atomic_ref<U64> mem(p->data);
     U64 expected = ((U64)EDX) << 32 | EAX;
     U64 value = ((U64)ECX) << 32 | EBX;
 
     cpu->fillFlags();
-
-    LockData64* p = (LockData64*)cpu->memory->getRamPtr(address, 8, true);
-    std::atomic_ref<U64> mem(p->data);
-
     if (mem.compare_exchange_strong(expected, value)) {
         cpu->addZF();
     } else {
@@ -216,25 +219,9 @@ void common_cmpxchg8b_lock(CPU* cpu, U32 address) {
         EDX = (U32)(expected >> 32);
         EAX = (U32)expected;
     }
-    */
 }
 #endif
 
-void common_cmpxchg8b(CPU* cpu, U32 address){
-    U64 value1 = ((U64)EDX) << 32 | EAX;
-    U64 value2 = cpu->memory->readq(address);
-    cpu->fillFlags();
-    if (value1 == value2) {
-        cpu->addZF();
-        cpu->memory->writed(address, EBX);
-        cpu->memory->writed(address + 4, ECX);
-    } else {
-        cpu->removeZF();
-        EDX = (U32)(value2 >> 32);
-        EAX = (U32)value2;
-    }
-}
-
 void common_fxsave(CPU* cpu, U32 address) {
     cpu->memory->writew(address + 0, (U16)cpu->fpu.CW());
     cpu->memory->writew(address + 2, (U16)cpu->fpu.SW());
@@ -85,92 +85,59 @@ void common_cmpxchge32r32(CPU* cpu, U32 address, U32 srcReg){
 }
 
 #ifdef BOXEDWINE_MULTI_THREADED
+// the flags come from the value the compare exchange saw, a separate read before it could be stale by then
 void common_cmpxchge32r32_lock(CPU* cpu, U32 address, U32 srcReg) {
-    BOXEDWINE_CRITICAL_SECTION;
-    cpu->dst.u32 = EAX;
-    cpu->src.u32 = cpu->memory->readd(address);
-    cpu->result.u32 = cpu->dst.u32 - cpu->src.u32;
-    cpu->lazyFlags = FLAGS_CMP32;
-    if (EAX == cpu->src.u32) {
-        cpu->memory->writed(address, cpu->reg[srcReg].u32);
-    } else {
-        EAX = cpu->src.u32;
+    LockData32* p = (LockData32*)cpu->memory->getLockPtr(address, 4);
+    if (!p) {
+        KMemoryStripeLock lock(address, 4);
+        common_cmpxchge32r32(cpu, address, srcReg);
+        return;
     }
-    /*
-    cpu->dst.u32 = EAX;
-    cpu->src.u32 = cpu->memory->readd(address);
-    cpu->result.u32 = cpu->dst.u32 - cpu->src.u32;
-    cpu->lazyFlags = FLAGS_CMP32;
-
-    LockData32* p = (LockData32*)cpu->memory->getRamPtr(address, 4, true);
     std::atomic_ref<U32> mem(p->data);
     U32 expected = EAX;
-    U32 desired = cpu->reg[srcReg].u32;
 
-    if (!mem.compare_exchange_strong(expected, desired)) {
+    cpu->dst.u32 = EAX;
+    if (!mem.compare_exchange_strong(expected, cpu->reg[srcReg].u32)) {
         EAX = expected;
-        cpu->src.u32 = expected;
-        cpu->result.u32 = cpu->dst.u32 - cpu->src.u32;
     }
-    */
+    cpu->src.u32 = expected;
+    cpu->result.u32 = cpu->dst.u32 - cpu->src.u32;
+    cpu->lazyFlags = FLAGS_CMP32;
 }
 void common_cmpxchge16r16_lock(CPU* cpu, U32 address, U32 srcReg) {
-    BOXEDWINE_CRITICAL_SECTION;
-    cpu->dst.u16 = AX;
-    cpu->src.u16 = cpu->memory->readw(address);
-    cpu->result.u16 = cpu->dst.u16 - cpu->src.u16;
-    cpu->lazyFlags = FLAGS_CMP16;
-    if (AX == cpu->src.u16) {
-        cpu->memory->writew(address, cpu->reg[srcReg].u16);
-    } else {
-        AX = cpu->src.u16;
+    LockData16* p = (LockData16*)cpu->memory->getLockPtr(address, 2);
+    if (!p) {
+        KMemoryStripeLock lock(address, 2);
+        common_cmpxchge16r16(cpu, address, srcReg);
+        return;
     }
-    /*
-    cpu->dst.u16 = AX;
-    cpu->src.u16 = cpu->memory->readw(address);
-    cpu->result.u16 = cpu->dst.u16 - cpu->src.u16;
-    cpu->lazyFlags = FLAGS_CMP16;
-
-    LockData16* p = (LockData16*)cpu->memory->getRamPtr(address, 2, true);
     std::atomic_ref<U16> mem(p->data);
-
     U16 expected = AX;
-    U16 desired = cpu->reg[srcReg].u16;
 
-    if (!mem.compare_exchange_strong(expected, desired)) {
+    cpu->dst.u16 = AX;
+    if (!mem.compare_exchange_strong(expected, cpu->reg[srcReg].u16)) {
         AX = expected;
-        cpu->src.u16 = expected;
-        cpu->result.u16 = cpu->dst.u16 - cpu->src.u16;
     }
-    */
+    cpu->src.u16 = expected;
+    cpu->result.u16 = cpu->dst.u16 - cpu->src.u16;
+    cpu->lazyFlags = FLAGS_CMP16;
 }
 void common_cmpxchge8r8_lock(CPU* cpu, U32 address, U32 srcReg) {
-    BOXEDWINE_CRITICAL_SECTION;
-    cpu->dst.u8 = AL;
-    cpu->src.u8 = cpu->memory->readb(address);
-    cpu->result.u8 = cpu->dst.u8 - cpu->src.u8;
-    cpu->lazyFlags = FLAGS_CMP8;
-    if (AL == cpu->src.u8) {
-        cpu->memory->writeb(address, *cpu->reg8[srcReg]);
-    } else {
-        AL = cpu->src.u8;
+    LockData8* p = (LockData8*)cpu->memory->getLockPtr(address, 1);
+    if (!p) {
+        KMemoryStripeLock lock(address, 1);
+        common_cmpxchge8r8(cpu, address, srcReg);
+        return;
     }
-    /*
-    cpu->dst.u8 = AL;
-    cpu->src.u8 = cpu->memory->readb(address);
-    cpu->result.u8 = cpu->dst.u8 - cpu->src.u8;
-    cpu->lazyFlags = FLAGS_CMP8;
-
-    LockData8* p = (LockData8*)cpu->memory->getRamPtr(address, 1, true);
     std::atomic_ref<U8> mem(p->data);
     U8 expected = AL;
-    U8 desired = *cpu->reg8[srcReg];
 
-    if (!mem.compare_exchange_strong(expected, desired)) {
+    cpu->dst.u8 = AL;
+    if (!mem.compare_exchange_strong(expected, *cpu->reg8[srcReg])) {
         AL = expected;
-        cpu->src.u8 = expected;
-        cpu->result.u8 = cpu->dst.u8 - cpu->src.u8;
     }
-    */
+    cpu->src.u8 = expected;
+    cpu->result.u8 = cpu->dst.u8 - cpu->src.u8;
+    cpu->lazyFlags = FLAGS_CMP8;
 }
 #endif
\ No newline at end of file
@@ -18,6 +18,8 @@
 
 #include "boxedwine.h"
 #include <math.h>
+#include <float.h>
+#include <fenv.h>
 #include "fpu.h"
 
 #define FMASK_TEST (CF | PF | AF | ZF | SF | OF)    
@@ -106,6 +108,9 @@ struct FPU_Float {
 #define ROUND_Up 2
 #define ROUND_Chop 3
 
+#define PRECISION_24 0
+#define PRECISION_64 3
+
 #define FPU_GET_TOP(fpu) (((fpu)->sw & 0x3800) >> 11)
 #define FPU_SET_TOP(fpu, val) (fpu)->sw &= ~0x3800; (fpu)->sw |= (val & 7) << 11
 
@@ -167,6 +172,7 @@ void FPU::SetCW(U16 word) {
     this->cw = word;
     this->cw_mask_all = word | 0x3f;
     this->round = ((word >> 10) & 3);
+    this->useF64 = KSystem::useF64 && ((word >> 8) & 3) != PRECISION_64;
 
 #ifdef LOG_FPU
     const char* r;
@@ -248,6 +254,34 @@ uint_fast8_t FPU::getSoftRounding() {
     }
 }
 
+static const int hostRounding[] = { FE_TONEAREST, FE_DOWNWARD, FE_UPWARD, FE_TOWARDZERO };
+
+// runs host double math with the rounding and precision from the control word.  Round to nearest at 53-bit precision
+// is what the host already does so that common case never touches the host fp environment.  The operands go through
+// volatiles so that the compiler can't do the math before the rounding mode is set.  At 24-bit precision the result is
+// rounded again to 24 bits, for +-*/ and sqrt rounding twice like this gives the same answer as rounding once.  Only
+// the significand is rounded, the x87 keeps its full exponent range at every precision, so the value is scaled into
+// [0.5, 1) first, which also keeps results beyond the float range from overflowing or going denormal.
+template <typename T>
+static double hostF64(FPU* fpu, double x, double y, T op) {
+    bool precision24 = ((fpu->cw >> 8) & 3) == PRECISION_24;
+    if (fpu->round == ROUND_Nearest && !precision24) {
+        return op(x, y);
+    }
+    int oldRounding = fegetround();
+    fesetround(hostRounding[fpu->round]);
+    volatile double a = x;
+    volatile double b = y;
+    volatile double result = op(a, b);
+    if (precision24 && result != 0.0 && isfinite(result)) {
+        int exp;
+        double significand = frexp(result, &exp);
+        result = ldexp((double)(float)significand, exp);
+    }
+    fesetround(oldRounding);
+    return result;
+}
+
 void FPU::ST80(CPU* cpu, U32 addr, int reg) {
     extFloat80_t& f80 = getReg(reg);
     cpu->memory->writeq(addr, f80.signif);
@@ -267,7 +301,7 @@ void FPU::ST80(U32 reg, U64* pLow, U64* pHigh) {
 }
 
 void FPU::FLD_F32(U32 value, int store_to) {
-    if (KSystem::useF64) {
+    if (this->useF64) {
         struct FPU_Float f;
         f.i = value;
         regCache[store_to].d = (double)f.f;
@@ -280,7 +314,7 @@ void FPU::FLD_F32(U32 value, int store_to) {
 }
 
 void FPU::FLD_F64(U64 value, int store_to) {
-    if (KSystem::useF64) {
+    if (this->useF64) {
         regCache[store_to].l = value;
         isRegCached[store_to] = true;
     } else {
@@ -314,7 +348,7 @@ void FPU::FLD_F80(U64 low, S16 high) {
 }
 
 void FPU::FLD_I16(S16 value, int store_to) {
-    if (KSystem::useF64) {
+    if (this->useF64) {
         regCache[store_to].d = (double)value;
         isRegCached[store_to] = true;
     } else {
@@ -323,7 +357,7 @@ void FPU::FLD_I16(S16 value, int store_to) {
 }
 
 void FPU::FLD_I32(S32 value, int store_to) {
-    if (KSystem::useF64) {
+    if (this->useF64) {
         regCache[store_to].d = (double)value;
         isRegCached[store_to] = true;
     } else {
@@ -375,7 +409,7 @@ void FPU::FLD_I16_EA(CPU* cpu, U32 address) {
 void FPU::FST_F32(CPU* cpu, U32 addr) {
     if (isRegCached[this->top]) {
         struct FPU_Float f;
-        f.f = (float)this->regCache[this->top].d;
+        f.f = (float)hostF64(this, this->regCache[this->top].d, 0.0, [](double x, double) { return (double)(float)x; });
         cpu->memory->writed(addr, f.i);
     } else {
         softfloat_roundingMode = getSoftRounding();
@@ -470,55 +504,55 @@ void FPU::FBST(CPU* cpu, U32 addr) {
 }
 
 void FPU::FADD(int op1, int op2) {
-    if (KSystem::useF64) {
-        this->regCache[op1].d = getF64(op1) + getF64(op2);
+    if (this->useF64) {
+        this->regCache[op1].d = hostF64(this, getF64(op1), getF64(op2), [](double x, double y) { return x + y; });
     } else {
-        this->regs[op1] = extF80_add(this->regs[op1], this->regs[op2]);
+        this->regs[op1] = extF80_add(getReg(op1), getReg(op2));
     }
     //flags and such :)
 }
 
 void FPU::FDIV(int st, int other) {
-    if (KSystem::useF64) {
-        this->regCache[st].d = getF64(st) / getF64(other);
+    if (this->useF64) {
+        this->regCache[st].d = hostF64(this, getF64(st), getF64(other), [](double x, double y) { return x / y; });
     } else {
-        this->regs[st] = extF80_div(this->regs[st], this->regs[other]);
+        this->regs[st] = extF80_div(getReg(st), getReg(other));
     }
     //flags and such :)
 }
 
 void FPU::FDIVR(int st, int other) {
-    if (KSystem::useF64) {
-        this->regCache[st].d = getF64(other) / getF64(st);
+    if (this->useF64) {
+        this->regCache[st].d = hostF64(this, getF64(other), getF64(st), [](double x, double y) { return x / y; });
     } else {
-        this->regs[st] = extF80_div(this->regs[other], this->regs[st]);
+        this->regs[st] = extF80_div(getReg(other), getReg(st));
     }
     // flags and such :)
 }
 
 void FPU::FMUL(int st, int other) {
-    if (KSystem::useF64) {
-        this->regCache[st].d = getF64(st) * getF64(other);
+    if (this->useF64) {
+        this->regCache[st].d = hostF64(this, getF64(st), getF64(other), [](double x, double y) { return x * y; });
     } else {
-        this->regs[st] = extF80_mul(this->regs[st], this->regs[other]);
+        this->regs[st] = extF80_mul(getReg(st), getReg(other));
     }
     //flags and such :)
 }
 
 void FPU::FSUB(int st, int other) {
-    if (KSystem::useF64) {
-        this->regCache[st].d = getF64(st) - getF64(other);
+    if (this->useF64) {
+        this->regCache[st].d = hostF64(this, getF64(st), getF64(other), [](double x, double y) { return x - y; });
     } else {
-        this->regs[st] = extF80_sub(this->regs[st], this->regs[other]);
+        this->regs[st] = extF80_sub(getReg(st), getReg(other));
     }
     //flags and such :)
 }
 
 void FPU::FSUBR(int st, int other) {
-    if (KSystem::useF64) {
-        this->regCache[st].d = getF64(other) - getF64(st);
+    if (this->useF64) {
+        this->regCache[st].d = hostF64(this, getF64(other), getF64(st), [](double x, double y) { return x - y; });
     } else {
-        this->regs[st] = extF80_sub(this->regs[other], this->regs[st]);
+        this->regs[st] = extF80_sub(getReg(other), getReg(st));
     }
     //flags and such :)
 }
@@ -978,7 +1012,7 @@ void FPU::FYL2XP1() {
 
 void FPU::FSQRT() {
     if (isRegCached[top]) {
-        regCache[this->top].d = sqrt(regCache[this->top].d);
+        regCache[this->top].d = hostF64(this, regCache[this->top].d, 0.0, [](double x, double) { return sqrt(x); });
     } else {
         this->regs[this->top] = extF80_sqrt(this->regs[this->top]);
     }
@@ -1263,7 +1297,7 @@ void FPU::FTST(CPU* cpu) {
 
 void FPU::FLD1() {
     PREP_PUSH();
-    if (KSystem::useF64) {
+    if (this->useF64) {
         regCache[top].d = 1.0;
         isRegCached[top] = true;
     } else {
@@ -1274,7 +1308,7 @@ void FPU::FLD1() {
 
 void FPU::FLDL2T() {
     PREP_PUSH();
-    if (KSystem::useF64) {
+    if (this->useF64) {
         regCache[top].d = 3.3219280948873623;
         isRegCached[top] = true;
     } else {
@@ -1285,7 +1319,7 @@ void FPU::FLDL2T() {
 
 void FPU::FLDL2E() {
     PREP_PUSH();
-    if (KSystem::useF64) {
+    if (this->useF64) {
         regCache[top].d = 1.4426950408889634;
         isRegCached[top] = true;
     } else {
@@ -1296,7 +1330,7 @@ void FPU::FLDL2E() {
 
 void FPU::FLDPI() {
     PREP_PUSH();
-    if (KSystem::useF64) {
+    if (this->useF64) {
         regCache[top].d = 3.14159265358979323846;
         isRegCached[top] = true;
     } else {
@@ -1307,7 +1341,7 @@ void FPU::FLDPI() {
 
 void FPU::FLDLG2() {
     PREP_PUSH();
-    if (KSystem::useF64) {
+    if (this->useF64) {
         regCache[top].d = 0.3010299956639812;
         isRegCached[top] = true;
     } else {
@@ -1318,7 +1352,7 @@ void FPU::FLDLG2() {
 
 void FPU::FLDLN2() {
     PREP_PUSH();
-    if (KSystem::useF64) {
+    if (this->useF64) {
         regCache[top].d = 0.69314718055994531;
         isRegCached[top] = true;
     } else {
@@ -1329,7 +1363,7 @@ void FPU::FLDLN2() {
 
 void FPU::FLDZ() {
     PREP_PUSH();
-    if (KSystem::useF64) {
+    if (this->useF64) {
         regCache[top].d = 0.0;
         isRegCached[top] = true;
     } else {
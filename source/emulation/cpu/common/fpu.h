@@ -245,6 +245,10 @@ public:
 
     bool isRegCached[9];
     bool isMMXInUse;
+
+    // set from the precision control bits, 24 and 53-bit precision keep values loaded or calculated in regCache as
+    // host doubles, 64-bit precision uses softfloat
+    bool useF64;
 };
 
 #endif
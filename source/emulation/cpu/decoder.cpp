@@ -6033,6 +6033,7 @@ U32 DecodeData::fetch32() {
 }
 
 static PtrPool<DecodedOp> freeOps;
+static PtrPool<DecodedBlockFromNode> freeFromNodes(1024);
 
 DecodedOp::DecodedOp() {
     this->reset();
@@ -6061,6 +6062,13 @@ DecodedOp* DecodedOp::alloc() {
     return freeOps.get();   
 }
 
+BString DecodedOp::getPoolStats() {
+    BString result = freeOps.getStats("ops");
+    result.append(" ");
+    result.append(freeFromNodes.getStats("from nodes"));
+    return result;
+}
+
 void DecodedOp::dealloc(bool deallocNext) {
 #ifdef _DEBUG
     if (this->inst == InstructionCount) {
@@ -6102,6 +6110,46 @@ bool DecodedOp::needsToSetFlags(CPU* cpu) {
 
 U32 DecodedOp::getNeededFlags(DecodedBlock* block, DecodedOp* op, U32 flags, U32 depth) {
     DecodedOp* n = op->next;
+
+#ifdef BOXEDWINE_BINARY_TRANSLATOR
+    if (instructionInfo[op->inst].branch) {
+        return getNeededFlagsAfterBranch(block, op, flags, depth);
+    }
+    U32 result = 0;
+    // the ops after the end of the chunk can change without this translation being thrown away
+    U32 end = block ? block->translatedEnd : 0;
+    U32 eip = 0;
+    if (end) {
+        eip = block->getOpEip(op);
+        if (!eip) {
+            return flags;
+        }
+        eip += op->len;
+    }
+
+    while (n && flags) {
+        if (end && eip >= end) {
+            break;
+        }
+        U32 used = instructionInfo[n->inst].flagsUsed & flags;
+        result |= used;
+        flags &= ~used;
+        if (!(instructionInfo[n->inst].flagsSets & MAYBE)) {
+            flags &= ~ instructionInfo[n->inst].flagsSets;
+            flags &= ~ instructionInfo[n->inst].flagsUndefined;
+        }
+        // n->next is the op that follows in memory, it is not necessarily what runs next
+        if (instructionInfo[n->inst].branch) {
+            if (flags) {
+                result |= getNeededFlagsAfterBranch(block, n, flags, depth);
+            }
+            return result;
+        }
+        eip += n->len;
+        n = n->next;
+    }
+    return result | flags;
+#else
     DecodedOp* lastOp = op;
 
     while (n && flags) {
@@ -6119,11 +6167,6 @@ U32 DecodedOp::getNeededFlags(DecodedBlock* block, DecodedOp* op, U32 flags, U32
             flags &= ~ instructionInfo[n->inst].flagsSets;
             flags &= ~ instructionInfo[n->inst].flagsUndefined;
         }
-#ifdef BOXEDWINE_BINARY_TRANSLATOR
-        if (instructionInfo[n->inst].branch) {
-            break;
-        }
-#endif
         lastOp = n;
         n = n->next;
     }
@@ -6144,38 +6187,99 @@ U32 DecodedOp::getNeededFlags(DecodedBlock* block, DecodedOp* op, U32 flags, U32
         }
     }
     return flags;
+#endif
 }
 
-static DecodedBlockFromNode* freeFromNodes;
-static BOXEDWINE_MUTEX freeFromNodesMutex;
+#ifdef BOXEDWINE_BINARY_TRANSLATOR
+#define ALL_FLAGS (CF | PF | SF | ZF | AF | OF)
 
-DecodedBlockFromNode* DecodedBlockFromNode::alloc() {
-    DecodedBlockFromNode* result = nullptr;
-    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(freeFromNodesMutex);
+// flags that are read before being written starting with op
+U32 DecodedOp::getNeededFlagsAt(DecodedBlock* block, DecodedOp* op, U32 flags, U32 depth) {
+    U32 result = instructionInfo[op->inst].flagsUsed & flags;
+    flags &= ~result;
+    if (!(instructionInfo[op->inst].flagsSets & MAYBE)) {
+        flags &= ~instructionInfo[op->inst].flagsSets;
+        flags &= ~instructionInfo[op->inst].flagsUndefined;
+    }
+    if (!flags) {
+        return result;
+    }
+    if (instructionInfo[op->inst].branch) {
+        return result | getNeededFlagsAfterBranch(block, op, flags, depth);
+    }
+    return result | getNeededFlags(block, op, flags, depth);
+}
 
-    if (freeFromNodes) {
-        result = freeFromNodes;
-        freeFromNodes = freeFromNodes->next;
+// Follows the direct branches whose targets are in the part of the block that is being translated.  That part is translated
+// as a unit, if any of its code changes then the whole translation is thrown away, so the answer can't go stale.  The
+// block can be decoded past where the chunk stops, that code is run by another chunk so it is treated like any other
+// target outside of the chunk.  Indirect branches, returns and those targets could run anything, so all the flags are
+// needed.
+U32 DecodedOp::getNeededFlagsAfterBranch(DecodedBlock* block, DecodedOp* op, U32 flags, U32 depth) {
+    U32 branch = instructionInfo[op->inst].branch;
+
+    if (!block || !depth || !(branch & DECODE_BRANCH_1) || (branch & DECODE_BRANCH_NO_CACHE)) {
+        return flags;
+    }
+    U32 eip = block->getOpEip(op);
+    if (!eip) {
+        return flags;
+    }
+    U32 result = 0;
+    U32 end = block->getTranslatedEnd();
+    if (branch & DECODE_BRANCH_2) {
+        // conditional, the next op in the block is the fall through
+        if (op->next && eip + op->len < end) {
+            result |= getNeededFlagsAt(block, op->next, flags, depth - 1);
+        } else {
+            result |= flags;
+        }
+    }
+    U32 target = eip + op->len + op->imm;
+    if (target >= block->address && target < end) {
+        U32 cached = 0;
+        if (!block->neededFlagsCache) {
+            block->neededFlagsCache = new BHashTable<U32, U32>();
+        }
+        if (!block->neededFlagsCache->get(target, cached)) {
+            DecodedOp* targetOp = block->getOp(target);
+            // ALL_FLAGS so that the cached answer works for any query, each flag is tracked independently
+            cached = targetOp ? getNeededFlagsAt(block, targetOp, ALL_FLAGS, depth - 1) : ALL_FLAGS;
+            block->neededFlagsCache->set(target, cached);
+        }
+        result |= cached & flags;
     } else {
-        DecodedBlockFromNode* nodes = new DecodedBlockFromNode[1024];
+        result |= flags;
+    }
+    return result;
+}
 
-        freeFromNodes = &nodes[1];
-        freeFromNodes->next = nullptr;
-        for (int i=2;i<1024;i++) {
-            nodes[i].next = freeFromNodes;
-            freeFromNodes = &nodes[i];            
+U32 DecodedBlock::getOpEip(DecodedOp* op) {
+    DecodedOp* o = this->op;
+    U32 eip = this->address;
+
+    while (o) {
+        if (o == op) {
+            return eip;
         }
-        result = &nodes[0];
+        eip += o->len;
+        o = o->next;
     }
-    result->next = nullptr;
-    result->block = nullptr;
-    return result;
+    return 0;
 }
-void DecodedBlockFromNode::dealloc() {
-    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(freeFromNodesMutex);
-    this->next = freeFromNodes;
+#endif
+
+void DecodedBlockFromNode::reset() {
     this->block = nullptr;
-    freeFromNodes = this;
+    this->next = nullptr;
+}
+
+DecodedBlockFromNode* DecodedBlockFromNode::alloc() {
+    return freeFromNodes.get();
+}
+
+void DecodedBlockFromNode::dealloc() {
+    freeFromNodes.put(this);
 }
 
 void DecodedBlock::addReferenceFrom(DecodedBlock* block) {
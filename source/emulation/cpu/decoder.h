@@ -1471,6 +1471,7 @@ class DecodedOp {
 public:    
     static DecodedOp* alloc();
     static void clearCache();
+    static BString getPoolStats();
 
     DecodedOp();
 
@@ -1483,6 +1484,10 @@ public:
     const char* name();
 
     static U32 getNeededFlags(DecodedBlock* block, DecodedOp* op, U32 flags, U32 depth=2);
+#ifdef BOXEDWINE_BINARY_TRANSLATOR
+    static U32 getNeededFlagsAt(DecodedBlock* block, DecodedOp* op, U32 flags, U32 depth);
+    static U32 getNeededFlagsAfterBranch(DecodedBlock* block, DecodedOp* op, U32 flags, U32 depth);
+#endif
 
     DecodedOp* next;
     OpCallback pfn;
@@ -1522,6 +1527,7 @@ class DecodedBlockFromNode {
 public:
     static DecodedBlockFromNode* alloc();
     virtual void dealloc();
+    void reset();
 
     DecodedBlock* block = nullptr;
     DecodedBlockFromNode* next = nullptr;
@@ -1550,6 +1556,20 @@ public:
     U32 getEip() { return address; }
     U32 getEipLen() { return bytes; }
     DecodedOp* getOp(U32 eip);
+#ifdef BOXEDWINE_BINARY_TRANSLATOR
+    U32 getOpEip(DecodedOp* op);
+
+    // flags that are live at the targets of direct branches inside this block, see DecodedOp::getNeededFlagsAfterBranch.
+    // This must be cleared whenever the ops of the block change
+    BHashTable<U32, U32>* neededFlagsCache = nullptr;
+    void clearNeededFlagsCache() { delete neededFlagsCache; neededFlagsCache = nullptr; }
+
+    // ops at or after this eip were decoded but are not in the chunk being translated, 0 means the whole block is.
+    // Answers cached with a smaller end only need more flags, so the cache only has to go when the end shrinks.
+    U32 translatedEnd = 0;
+    void setTranslatedEnd(U32 end) { if (!translatedEnd || end < translatedEnd) clearNeededFlagsCache(); translatedEnd = end; }
+    U32 getTranslatedEnd() { return translatedEnd ? translatedEnd : address + bytes; }
+#endif
 protected:
     DecodedBlockFromNode* referencedFrom = nullptr;    
 };
@@ -66,7 +66,8 @@
 #include "normal_move.h"
 
 static OpCallback normalOps[NUMBER_OF_OPS];
-static U32 normalOpsInitialized;
+static std::atomic<bool> normalOpsInitialized;
+static BOXEDWINE_MUTEX normalOpsMutex;
 
 void OPCALL normal_sidt(CPU* cpu, DecodedOp* op) {
     START_OP(cpu, op);    
@@ -82,7 +83,10 @@ void OPCALL normal_sidt(CPU* cpu, DecodedOp* op) {
 static void initNormalOps() {
     if (normalOpsInitialized)
         return;
-    normalOpsInitialized = 1;   
+    // the binary translator decodes blocks without holding the memory mutex, so more than one thread can get here
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(normalOpsMutex);
+    if (normalOpsInitialized)
+        return;
     for (int i=0;i<InstructionCount;i++) {
         normalOps[i] = normal_invalid;
     }
@@ -114,6 +118,7 @@ static void initNormalOps() {
     normalOps[LMSW] = nullptr;
     normalOps[INVLPG] = nullptr;
     normalOps[Callback] = onExitSignal;
+    normalOpsInitialized = true;
 }
 
 OpCallback NormalCPU::getFunctionForOp(DecodedOp* op) {
@@ -177,6 +182,10 @@ void NormalBlock::reset() {
     this->next1 = nullptr;
     this->next2 = nullptr;
     this->referencedFrom = nullptr;
+#ifdef BOXEDWINE_BINARY_TRANSLATOR
+    this->clearNeededFlagsCache();
+    this->translatedEnd = 0;
+#endif
 }
 
 void NormalBlock::clearCache() {
@@ -237,6 +246,10 @@ void NormalBlock::dealloc(bool delayed) {
     }
     this->referencedFrom = nullptr;
     if (doDelete) {
+#ifdef BOXEDWINE_BINARY_TRANSLATOR
+        this->clearNeededFlagsCache();
+        this->translatedEnd = 0;
+#endif
         freeBlocks.put(this);
     }
 }
@@ -247,124 +260,76 @@ void OPCALL emptyInst(CPU* cpu, DecodedOp* op) {
 
 DecodedOp emptyOp;
 
-void OPCALL lockOp8(CPU* cpu, DecodedOp* op) {
-    BOXEDWINE_CRITICAL_SECTION;
-    normalOps[op->inst](cpu, op);
-    /*
-    START_OP(cpu, op);
-    if (!cpu->tmpLockAddress) {
-        cpu->tmpLockAddress = cpu->thread->process->alloc(cpu->thread, 4);
+template <typename T>
+static T readLockValue(KMemory* memory, U32 address) {
+    if constexpr (sizeof(T) == 1) {
+        return memory->readb(address);
+    } else if constexpr (sizeof(T) == 2) {
+        return memory->readw(address);
+    } else {
+        return memory->readd(address);
     }
-    U32 address = eaa(cpu, op);
-    DecodedOp lockedOp = *op;
-    lockedOp.base = SEG_ZERO;
-    lockedOp.rm = regZero;
-    lockedOp.sibIndex = regZero;
-    lockedOp.sibScale = 0;
-    lockedOp.disp = cpu->tmpLockAddress;
-    lockedOp.ea16 = 0;
-
-    LockData8* p = (LockData8*)cpu->memory->getRamPtr(address, 1, true);
-    std::atomic_ref<U8> mem(p->data);
-    Reg savedRegs[8];
-    U32 savedEip = cpu->eip.u32;
+}
 
-    for (int i = 0; i < 8; i++) {
-        savedRegs[i] = cpu->reg[i];
+template <typename T>
+static void writeLockValue(KMemory* memory, U32 address, T value) {
+    if constexpr (sizeof(T) == 1) {
+        memory->writeb(address, value);
+    } else if constexpr (sizeof(T) == 2) {
+        memory->writew(address, value);
+    } else {
+        memory->writed(address, value);
     }
+}
 
-    lockedOp.next = &emptyOp;
-
-    while (true) {
-        U8 oldValue = cpu->memory->readb(address);
-        cpu->memory->writeb(cpu->tmpLockAddress, oldValue);
-
-        normalOps[op->inst](cpu, &lockedOp);
-
-        U8 newValue = cpu->memory->readb(cpu->tmpLockAddress);
-
-        if (mem.compare_exchange_weak(oldValue, newValue)) {
-            break;
-        }
-        for (int i = 0; i < 8; i++) {
-            cpu->reg[i] = savedRegs[i];
-        }
+// the bit in the memory operand that the register selects can be outside of the operand, the locked op works on the
+// operand that holds the bit using the immediate version of the instruction
+static U32 getLockedBitInst(U32 inst) {
+    switch (inst) {
+    case BtsE16R16: return BtsE16;
+    case BtrE16R16: return BtrE16;
+    case BtcE16R16: return BtcE16;
+    case BtsE32R32: return BtsE32;
+    case BtrE32R32: return BtrE32;
+    case BtcE32R32: return BtcE32;
+    default: return 0;
     }
-    cpu->eip.u32 = savedEip;
-    NEXT();
-    */
 }
 
-void OPCALL lockOp16(CPU* cpu, DecodedOp* op) {
-    BOXEDWINE_CRITICAL_SECTION;
-    normalOps[op->inst](cpu, op);
-    /*
+// The op runs on a copy of the memory operand in cpu->tmpLockAddress and the result is published with a compare
+// exchange on the host memory.  If another thread changed the memory in between, the registers and flags are put back
+// and the op runs again with the new value.  Memory that can't be used with a host atomic falls back to a striped lock,
+// that is only atomic with respect to other LOCK prefixed accesses that also had to fall back.
+template <typename T>
+static void lockOp(CPU* cpu, DecodedOp* op) {
     START_OP(cpu, op);
-    if (!cpu->tmpLockAddress) {
-        cpu->tmpLockAddress = cpu->thread->process->alloc(cpu->thread, 4);
-    }
-    U32 address = eaa(cpu, op);
     DecodedOp lockedOp = *op;
-    lockedOp.base = SEG_ZERO;
-    lockedOp.rm = regZero;
-    lockedOp.sibIndex = regZero;
-    lockedOp.sibScale = 0;
-    lockedOp.disp = cpu->tmpLockAddress;
-    lockedOp.ea16 = 0;
-
-    LockData16* p= (LockData16*)cpu->memory->getRamPtr(address, 2, true);
-    auto iptr = reinterpret_cast<std::uintptr_t>(p);
-    if (iptr % 2) {
-        BOXEDWINE_CRITICAL_SECTION;
-        normalOps[op->inst](cpu, op);
-        return;
-    }
-    std::atomic_ref<U16> mem(p->data);
-    Reg savedRegs[8];
+    DecodedOp* p = &lockedOp;
+    U32 bitInst = getLockedBitInst(op->inst);
     U32 savedEip = cpu->eip.u32;
 
-    for (int i = 0; i < 8; i++) {
-        savedRegs[i] = cpu->reg[i];
-    }
-
     lockedOp.next = &emptyOp;
+    if (bitInst) {
+        S32 bit = (sizeof(T) == 2) ? (S32)(S16)cpu->reg[op->reg].u16 : (S32)cpu->reg[op->reg].u32;
+        lockedOp.inst = bitInst;
+        lockedOp.imm = 1 << (bit & (sizeof(T) * 8 - 1));
+        lockedOp.disp += (bit >> (sizeof(T) == 2 ? 4 : 5)) * (S32)sizeof(T);
+    }
+    U32 address = eaa(cpu, p);
+    T* ram = (T*)cpu->memory->getLockPtr(address, sizeof(T));
 
-    while (true) {
-        U16 oldValue = cpu->memory->readw(address);
-        cpu->memory->writew(cpu->tmpLockAddress, oldValue);
-
-        normalOps[op->inst](cpu, &lockedOp);
-
-        U16 newValue = cpu->memory->readw(cpu->tmpLockAddress);
-
-        if (mem.compare_exchange_weak(oldValue, newValue)) {
-            break;
-        }
-        for (int i = 0; i < 8; i++) {
-            cpu->reg[i] = savedRegs[i];
+    if (!ram) {
+        {
+            KMemoryStripeLock lock(address, sizeof(T));
+            normalOps[lockedOp.inst](cpu, &lockedOp);
         }
+        cpu->eip.u32 = savedEip;
+        NEXT();
+        return;
     }
-    cpu->eip.u32 = savedEip;
-    NEXT();
-    */
-}
-
-void OPCALL lockOp32(CPU* cpu, DecodedOp* op) {
-    // :TODO: not sure why std::atomic_ref didn't work for me, it passes unit tests, but I see problems, especially in high contention areas
-    // like the audio thread where pthread_mutex will use cmpxchge32r32 with futex a lot.  The symptom that cmpxchge32r32 didn't work correctly
-    // is that 2 threads end up waiting on the same value for a futex
-
-    // this is pretty heavy to do a global lock for this instruction and the rest of the instructions in this block, but most blocks are small
-    // and so far this hasn't been a problem
-    BOXEDWINE_CRITICAL_SECTION;
-    normalOps[op->inst](cpu, op);
-    /*
-    START_OP(cpu, op);
     if (!cpu->tmpLockAddress) {
         cpu->tmpLockAddress = cpu->thread->process->alloc(cpu->thread, 4);
     }
-    U32 address = eaa(cpu, op);
-    DecodedOp lockedOp = *op;
     lockedOp.base = SEG_ZERO;
     lockedOp.rm = regZero;
     lockedOp.sibIndex = regZero;
@@ -372,41 +337,48 @@ void OPCALL lockOp32(CPU* cpu, DecodedOp* op) {
     lockedOp.disp = cpu->tmpLockAddress;
     lockedOp.ea16 = 0;
 
-    LockData32* p = (LockData32*)cpu->memory->getRamPtr(address, 4, true);
-    auto iptr = reinterpret_cast<std::uintptr_t>(p);
-    if (iptr % 4) {
-        BOXEDWINE_CRITICAL_SECTION;
-        normalOps[op->inst](cpu, op);
-        return;
-    }
-    std::atomic_ref<U32> mem(p->data);
+    // ops like adc and inc read the flags, every attempt has to start with the same ones
+    cpu->fillFlags();
+
+    std::atomic_ref<T> mem(*ram);
     Reg savedRegs[8];
-    U32 savedEip = cpu->eip.u32;
+    U32 savedFlags = cpu->flags;
+    T oldValue = mem.load();
 
     for (int i = 0; i < 8; i++) {
         savedRegs[i] = cpu->reg[i];
     }
-
-    lockedOp.next = &emptyOp;
-    
     while (true) {
-        U32 oldValue = cpu->memory->readd(address);   
-        cpu->memory->writed(cpu->tmpLockAddress, oldValue);
+        writeLockValue<T>(cpu->memory, cpu->tmpLockAddress, oldValue);
 
-        normalOps[op->inst](cpu, &lockedOp);
+        normalOps[lockedOp.inst](cpu, &lockedOp);
 
-        U32 newValue = cpu->memory->readd(cpu->tmpLockAddress);
+        T newValue = readLockValue<T>(cpu->memory, cpu->tmpLockAddress);
 
         if (mem.compare_exchange_weak(oldValue, newValue)) {
             break;
         }
         for (int i = 0; i < 8; i++) {
             cpu->reg[i] = savedRegs[i];
-        }        
+        }
+        cpu->flags = savedFlags;
+        cpu->lazyFlags = FLAGS_NONE;
+        cpu->eip.u32 = savedEip;
     }
     cpu->eip.u32 = savedEip;
     NEXT();
-    */
+}
+
+void OPCALL lockOp8(CPU* cpu, DecodedOp* op) {
+    lockOp<U8>(cpu, op);
+}
+
+void OPCALL lockOp16(CPU* cpu, DecodedOp* op) {
+    lockOp<U16>(cpu, op);
+}
+
+void OPCALL lockOp32(CPU* cpu, DecodedOp* op) {
+    lockOp<U32>(cpu, op);
 }
 
 void OPCALL lockCmpXchg8b(CPU* cpu, DecodedOp* op) {
@@ -562,3 +534,7 @@ void NormalCPU::run() {
 void NormalCPU::clearCache() {
     NormalBlock::clearCache();
 }
+
+BString NormalCPU::getPoolStats() {
+    return freeBlocks.getStats("blocks");
+}
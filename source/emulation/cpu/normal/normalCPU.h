@@ -26,6 +26,7 @@ public:
     NormalCPU(KMemory* memory);
 
     static void clearCache();
+    static BString getPoolStats();
 
     // from CPU
     void run() override;
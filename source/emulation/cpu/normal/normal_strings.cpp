@@ -17,6 +17,239 @@
  */
 
 #include "boxedwine.h"
+
+// The rep forms with 32-bit addresses work a page at a time on host pointers from KMemory::getRamPtr.  An element that
+// crosses a page, or a page that can't give a pointer because it isn't mapped or doesn't allow the access, is done one
+// element at a time through the normal memory path so that ECX, ESI and EDI are exact if it faults.  Writes to a page
+// with translated code are done an element at a time too, so the code is only removed when a value changes.
+
+// how many elements, up to count, starting at address stay on the same page, with DF set the elements go down from
+// address.  0 means the element at address crosses into the next page
+static U32 pageRun(U32 address, U32 width, S32 inc, U32 count) {
+    U32 offset = address & K_PAGE_MASK;
+    if (offset + width > K_PAGE_SIZE) {
+        return 0;
+    }
+    U32 result = (inc > 0) ? (K_PAGE_SIZE - offset) / width : offset / width + 1;
+    return std::min(result, count);
+}
+
+// address of the lowest byte touched by count elements starting at address
+static U32 runStart(U32 address, U32 width, S32 inc, U32 count) {
+    return (inc > 0) ? address : address - (count - 1) * width;
+}
+
+// byte offset into a run of count elements of element i in the order the cpu does them
+static U32 runOffset(U32 i, U32 width, S32 inc, U32 count) {
+    return ((inc > 0) ? i : count - 1 - i) * width;
+}
+
+template <typename T> static T readElement(KMemory* memory, U32 address);
+template <> U8 readElement<U8>(KMemory* memory, U32 address) { return memory->readb(address); }
+template <> U16 readElement<U16>(KMemory* memory, U32 address) { return memory->readw(address); }
+template <> U32 readElement<U32>(KMemory* memory, U32 address) { return memory->readd(address); }
+
+template <typename T> static void writeElement(KMemory* memory, U32 address, T value);
+template <> void writeElement<U8>(KMemory* memory, U32 address, U8 value) { memory->writeb(address, value); }
+template <> void writeElement<U16>(KMemory* memory, U32 address, U16 value) { memory->writew(address, value); }
+template <> void writeElement<U32>(KMemory* memory, U32 address, U32 value) { memory->writed(address, value); }
+
+template <typename T>
+static T hostElement(U8* p) {
+    T result;
+    ::memcpy(&result, p, sizeof(T));
+    return result;
+}
+
+template <typename T>
+static void movs32r(CPU* cpu, U32 base) {
+    U32 dBase = cpu->seg[ES].address;
+    U32 sBase = cpu->seg[base].address;
+    S32 inc = cpu->getDirection() * (S32)sizeof(T);
+
+    while (ECX) {
+        U32 src = sBase + ESI;
+        U32 dst = dBase + EDI;
+        U32 count = std::min(pageRun(src, sizeof(T), inc, ECX), pageRun(dst, sizeof(T), inc, ECX));
+        U32 len = count * sizeof(T);
+        U8* d = nullptr;
+        U8* s = nullptr;
+
+        if (count > 1) {
+            // dst first, if it has to be copied on write then src will see the new page when they are the same
+            d = cpu->memory->getDataRamPtr(runStart(dst, sizeof(T), inc, count), len);
+            if (d) {
+                s = cpu->memory->getRamPtr(runStart(src, sizeof(T), inc, count), len, false);
+            }
+        }
+        if (!s) {
+            writeElement<T>(cpu->memory, dst, readElement<T>(cpu->memory, src));
+            EDI += inc;
+            ESI += inc;
+            ECX--;
+            continue;
+        }
+        bool overlap = d < s + len && s < d + len;
+        if (overlap && ((inc > 0) ? d > s : d < s)) {
+            // x86 copies an element at a time, so this overlap repeats the pattern instead of acting like memmove
+            for (U32 i = 0; i < count; i++) {
+                U32 offset = runOffset(i, sizeof(T), inc, count);
+                T value = hostElement<T>(s + offset);
+                ::memcpy(d + offset, &value, sizeof(T));
+            }
+        } else {
+            ::memmove(d, s, len);
+        }
+        EDI += inc * count;
+        ESI += inc * count;
+        ECX -= count;
+    }
+}
+
+template <typename T>
+static void stos32r(CPU* cpu, T value) {
+    U32 dBase = cpu->seg[ES].address;
+    S32 inc = cpu->getDirection() * (S32)sizeof(T);
+
+    while (ECX) {
+        U32 dst = dBase + EDI;
+        U32 count = pageRun(dst, sizeof(T), inc, ECX);
+        U8* d = nullptr;
+
+        if (count > 1) {
+            d = cpu->memory->getDataRamPtr(runStart(dst, sizeof(T), inc, count), count * sizeof(T));
+        }
+        if (!d) {
+            writeElement<T>(cpu->memory, dst, value);
+            EDI += inc;
+            ECX--;
+            continue;
+        }
+        if (sizeof(T) == 1) {
+            ::memset(d, (U8)value, count);
+        } else {
+            for (U32 i = 0; i < count; i++) {
+                ::memcpy(d + i * sizeof(T), &value, sizeof(T));
+            }
+        }
+        EDI += inc * count;
+        ECX -= count;
+    }
+}
+
+// returns the last pair of elements compared, ES:EDI in v1 and DS:ESI in v2
+template <typename T>
+static void cmps32r(CPU* cpu, U32 rep_zero, U32 base, T& v1, T& v2) {
+    U32 dBase = cpu->seg[ES].address;
+    U32 sBase = cpu->seg[base].address;
+    S32 inc = cpu->getDirection() * (S32)sizeof(T);
+
+    while (ECX) {
+        U32 src = sBase + ESI;
+        U32 dst = dBase + EDI;
+        U32 count = std::min(pageRun(src, sizeof(T), inc, ECX), pageRun(dst, sizeof(T), inc, ECX));
+        U32 len = count * sizeof(T);
+        U8* d = nullptr;
+        U8* s = nullptr;
+
+        if (count > 1) {
+            d = cpu->memory->getRamPtr(runStart(dst, sizeof(T), inc, count), len, false);
+            if (d) {
+                s = cpu->memory->getRamPtr(runStart(src, sizeof(T), inc, count), len, false);
+            }
+        }
+        if (!s) {
+            v1 = readElement<T>(cpu->memory, dst);
+            v2 = readElement<T>(cpu->memory, src);
+            EDI += inc;
+            ESI += inc;
+            ECX--;
+            if ((v1 == v2) != rep_zero) {
+                return;
+            }
+            continue;
+        }
+        U32 done = count;
+        bool stop = false;
+
+        if (rep_zero && !::memcmp(d, s, len)) {
+            U32 offset = runOffset(count - 1, sizeof(T), inc, count);
+            v1 = hostElement<T>(d + offset);
+            v2 = hostElement<T>(s + offset);
+        } else {
+            for (U32 i = 0; i < count; i++) {
+                U32 offset = runOffset(i, sizeof(T), inc, count);
+                v1 = hostElement<T>(d + offset);
+                v2 = hostElement<T>(s + offset);
+                if ((v1 == v2) != rep_zero) {
+                    done = i + 1;
+                    stop = true;
+                    break;
+                }
+            }
+        }
+        EDI += inc * done;
+        ESI += inc * done;
+        ECX -= done;
+        if (stop) {
+            return;
+        }
+    }
+}
+
+// returns the last element compared
+template <typename T>
+static T scas32r(CPU* cpu, U32 rep_zero, T value) {
+    U32 dBase = cpu->seg[ES].address;
+    S32 inc = cpu->getDirection() * (S32)sizeof(T);
+    T v1 = 0;
+
+    while (ECX) {
+        U32 dst = dBase + EDI;
+        U32 count = pageRun(dst, sizeof(T), inc, ECX);
+        U8* d = nullptr;
+
+        if (count > 1) {
+            d = cpu->memory->getRamPtr(runStart(dst, sizeof(T), inc, count), count * sizeof(T), false);
+        }
+        if (!d) {
+            v1 = readElement<T>(cpu->memory, dst);
+            EDI += inc;
+            ECX--;
+            if ((value == v1) != rep_zero) {
+                return v1;
+            }
+            continue;
+        }
+        U32 done = count;
+        bool stop = false;
+
+        if (sizeof(T) == 1 && !rep_zero && inc > 0) {
+            // repnz scasb is strlen/memchr
+            U8* found = (U8*)::memchr(d, (U8)value, count);
+            if (found) {
+                done = (U32)(found - d) + 1;
+                stop = true;
+            }
+            v1 = d[done - 1];
+        } else {
+            for (U32 i = 0; i < count; i++) {
+                v1 = hostElement<T>(d + runOffset(i, sizeof(T), inc, count));
+                if ((value == v1) != rep_zero) {
+                    done = i + 1;
+                    stop = true;
+                    break;
+                }
+            }
+        }
+        EDI += inc * done;
+        ECX -= done;
+        if (stop) {
+            return v1;
+        }
+    }
+    return v1;
+}
 void movsb16(CPU* cpu, U32 base) {
     U32 dBase = cpu->seg[ES].address;
     U32 sBase = cpu->seg[base].address;
@@ -47,17 +280,7 @@ void movsb32(CPU* cpu, U32 base) {
     ESI+=inc;
 }
 void movsb32r(CPU* cpu, U32 base) {
-    U32 dBase = cpu->seg[ES].address;
-    U32 sBase = cpu->seg[base].address;
-    S32 inc = cpu->getDirection();
-    U32 count = ECX;
-    
-    for (U32 i=0;i<count;i++) {
-        cpu->memory->writeb(dBase+EDI, cpu->memory->readb(sBase+ESI));
-        EDI+=inc;
-        ESI+=inc;
-        ECX--;
-    }
+    movs32r<U8>(cpu, base);
 }
 void movsw16(CPU* cpu, U32 base) {
     U32 dBase = cpu->seg[ES].address;
@@ -89,17 +312,7 @@ void movsw32(CPU* cpu, U32 base) {
     ESI+=inc;
 }
 void movsw32r(CPU* cpu, U32 base) {
-    U32 dBase = cpu->seg[ES].address;
-    U32 sBase = cpu->seg[base].address;
-    S32 inc = cpu->getDirection() << 1;
-    U32 count = ECX;
-
-    for (U32 i=0;i<count;i++) {
-        cpu->memory->writew(dBase+EDI, cpu->memory->readw(sBase+ESI));
-        EDI+=inc;
-        ESI+=inc;
-        ECX--;
-    }
+    movs32r<U16>(cpu, base);
 }
 void movsd16(CPU* cpu, U32 base) {
     U32 dBase = cpu->seg[ES].address;
@@ -131,17 +344,7 @@ void movsd32(CPU* cpu, U32 base) {
     ESI+=inc;
 }
 void movsd32r(CPU* cpu, U32 base) {
-    U32 dBase = cpu->seg[ES].address;
-    U32 sBase = cpu->seg[base].address;
-    S32 inc = cpu->getDirection() << 2;
-    U32 count = ECX;
-    U32 i;
-    for (i=0;i<count;i++) {
-        cpu->memory->writed(dBase+EDI, cpu->memory->readd(sBase+ESI));
-        EDI+=inc;
-        ESI+=inc;
-        ECX--;
-    }
+    movs32r<U32>(cpu, base);
 }
 void cmpsb16(CPU* cpu, U32 rep_zero, U32 base) {
     U32 dBase = cpu->seg[ES].address;
@@ -195,21 +398,10 @@ void cmpsb32(CPU* cpu, U32 rep_zero, U32 base) {
     cpu->lazyFlags = FLAGS_SUB8;
 }
 void cmpsb32r(CPU* cpu, U32 rep_zero, U32 base) {
-    U32 dBase = cpu->seg[ES].address;
-    U32 sBase = cpu->seg[base].address;
-    S32 inc = cpu->getDirection();
-    U32 count = ECX;
-    if (count) {
-        U8 v1=0;
-        U8 v2=0;
-        for (U32 i=0;i<count;i++) {
-            v1 = cpu->memory->readb(dBase+EDI);
-            v2 = cpu->memory->readb(sBase+ESI);
-            EDI+=inc;
-            ESI+=inc;
-            ECX--;
-            if ((v1==v2)!=rep_zero) break;
-        }
+    if (ECX) {
+        U8 v1 = 0;
+        U8 v2 = 0;
+        cmps32r<U8>(cpu, rep_zero, base, v1, v2);
         cpu->dst.u8 = v2;
         cpu->src.u8 = v1;
         cpu->result.u8 = cpu->dst.u8 - cpu->src.u8;
@@ -267,21 +459,10 @@ void cmpsw32(CPU* cpu, U32 rep_zero, U32 base) {
     cpu->lazyFlags = FLAGS_SUB16;
 }
 void cmpsw32r(CPU* cpu, U32 rep_zero, U32 base) {
-    U32 dBase = cpu->seg[ES].address;
-    U32 sBase = cpu->seg[base].address;
-    S32 inc = cpu->getDirection() << 1;
-    U32 count = ECX;
-    if (count) {
-        U16 v1=0;
-        U16 v2=0;
-        for (U32 i=0;i<count;i++) {
-            v1 = cpu->memory->readw(dBase+EDI);
-            v2 = cpu->memory->readw(sBase+ESI);
-            EDI+=inc;
-            ESI+=inc;
-            ECX--;
-            if ((v1==v2)!=rep_zero) break;
-        }
+    if (ECX) {
+        U16 v1 = 0;
+        U16 v2 = 0;
+        cmps32r<U16>(cpu, rep_zero, base, v1, v2);
         cpu->dst.u16 = v2;
         cpu->src.u16 = v1;
         cpu->result.u16 = cpu->dst.u16 - cpu->src.u16;
@@ -339,21 +520,10 @@ void cmpsd32(CPU* cpu, U32 rep_zero, U32 base) {
     cpu->lazyFlags = FLAGS_SUB32;
 }
 void cmpsd32r(CPU* cpu, U32 rep_zero, U32 base) {
-    U32 dBase = cpu->seg[ES].address;
-    U32 sBase = cpu->seg[base].address;
-    S32 inc = cpu->getDirection() << 2;
-    U32 count = ECX;
-    if (count) {
-        U32 v1=0;
-        U32 v2=0;
-        for (U32 i=0;i<count;i++) {
-            v1 = cpu->memory->readd(dBase+EDI);
-            v2 = cpu->memory->readd(sBase+ESI);
-            EDI+=inc;
-            ESI+=inc;
-            ECX--;
-            if ((v1==v2)!=rep_zero) break;
-        }
+    if (ECX) {
+        U32 v1 = 0;
+        U32 v2 = 0;
+        cmps32r<U32>(cpu, rep_zero, base, v1, v2);
         cpu->dst.u32 = v2;
         cpu->src.u32 = v1;
         cpu->result.u32 = cpu->dst.u32 - cpu->src.u32;
@@ -380,15 +550,7 @@ void stosb32(CPU* cpu) {
     EDI += cpu->getDirection();
 }
 void stosb32r(CPU* cpu) {
-    U32 dBase = cpu->seg[ES].address;
-    S32 inc = cpu->getDirection();
-    U32 count = ECX;
-    
-    for (U32 i=0;i<count;i++) {
-        cpu->memory->writeb(dBase+EDI, AL);
-        EDI+=inc;
-        ECX--;
-    }
+    stos32r<U8>(cpu, AL);
 }
 void stosw16(CPU* cpu) {
     cpu->memory->writew(cpu->seg[ES].address+DI, AX);
@@ -410,15 +572,7 @@ void stosw32(CPU* cpu) {
     EDI += cpu->getDirection() << 1;
 }
 void stosw32r(CPU* cpu) {
-    U32 dBase = cpu->seg[ES].address;
-    S32 inc = cpu->getDirection() << 1;
-    U32 count = ECX;
-    
-    for (U32 i=0;i<count;i++) {
-        cpu->memory->writew(dBase+EDI, AX);
-        EDI+=inc;
-        ECX--;
-    }
+    stos32r<U16>(cpu, AX);
 }
 void stosd16(CPU* cpu) {
     cpu->memory->writed(cpu->seg[ES].address+DI, EAX);
@@ -440,15 +594,7 @@ void stosd32(CPU* cpu) {
     EDI += cpu->getDirection() << 2;
 }
 void stosd32r(CPU* cpu) {
-    U32 dBase = cpu->seg[ES].address;
-    S32 inc = cpu->getDirection() << 2;
-    U32 count = ECX;
-    
-    for (U32 i=0;i<count;i++) {
-        cpu->memory->writed(dBase+EDI, EAX);
-        EDI+=inc;
-        ECX--;
-    }
+    stos32r<U32>(cpu, EAX);
 }
 void lodsb16(CPU* cpu, U32 base) {
     AL = cpu->memory->readb(cpu->seg[base].address+SI);
@@ -579,17 +725,8 @@ void scasb32(CPU* cpu, U32 rep_zero) {
     cpu->lazyFlags = FLAGS_SUB8;
 }
 void scasb32r(CPU* cpu, U32 rep_zero) {
-    U32 dBase = cpu->seg[ES].address;
-    S32 inc = cpu->getDirection();
-    U32 count = ECX;
-    if (count) {
-        U8 v1=0;
-        for (U32 i=0;i<count;i++) {
-            v1 = cpu->memory->readb(dBase+EDI);
-            EDI+=inc;
-            ECX--;
-            if ((AL==v1)!=rep_zero) break;
-        }
+    if (ECX) {
+        U8 v1 = scas32r<U8>(cpu, rep_zero, AL);
         cpu->dst.u8 = AL;
         cpu->src.u8 = v1;
         cpu->result.u8 = AL - v1;
@@ -635,17 +772,8 @@ void scasw32(CPU* cpu, U32 rep_zero) {
     cpu->lazyFlags = FLAGS_SUB16;
 }
 void scasw32r(CPU* cpu, U32 rep_zero) {
-    U32 dBase = cpu->seg[ES].address;
-    S32 inc = cpu->getDirection() << 1;
-    U32 count = ECX;
-    if (count) {
-        U16 v1=0;
-        for (U32 i=0;i<count;i++) {
-            v1 = cpu->memory->readw(dBase+EDI);
-            EDI+=inc;
-            ECX--;
-            if ((AX==v1)!=rep_zero) break;
-        }
+    if (ECX) {
+        U16 v1 = scas32r<U16>(cpu, rep_zero, AX);
         cpu->dst.u16 = AX;
         cpu->src.u16 = v1;
         cpu->result.u16 = AX - v1;
@@ -691,17 +819,8 @@ void scasd32(CPU* cpu, U32 rep_zero) {
     cpu->lazyFlags = FLAGS_SUB32;
 }
 void scasd32r(CPU* cpu, U32 rep_zero) {
-    U32 dBase = cpu->seg[ES].address;
-    S32 inc = cpu->getDirection() << 2;
-    U32 count = ECX;
-    if (count) {
-        U32 v1=0;
-        for (U32 i=0;i<count;i++) {
-            v1 = cpu->memory->readd(dBase+EDI);
-            EDI+=inc;
-            ECX--;
-            if ((EAX==v1)!=rep_zero) break;
-        }
+    if (ECX) {
+        U32 v1 = scas32r<U32>(cpu, rep_zero, EAX);
         cpu->dst.u32 = EAX;
         cpu->src.u32 = v1;
         cpu->result.u32 = EAX - v1;
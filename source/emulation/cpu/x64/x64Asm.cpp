@@ -57,6 +57,7 @@
 #define CPU_OFFSET_FPU_BUFFER (U32)(offsetof(x64CPU, fpuBuffer))
 #define CPU_OFFSET_RETURN_HOST_ADDRESS (U32)(offsetof(x64CPU, returnHostAddress))
 #define CPU_OFFSET_RETRANSLATE_CHUNK_ADDRESS (U32)(offsetof(x64CPU, reTranslateChunkAddress))
+#define CPU_OFFSET_RETRANSLATE_HOT_CHUNK_ADDRESS (U32)(offsetof(x64CPU, retranslateHotChunkAddress))
 #define CPU_OFFSET_SYNC_TO_HOST_ADDRESS (U32)(offsetof(x64CPU, syncToHostAddress))
 #define CPU_OFFSET_SYNC_FROM_HOST_ADDRESS (U32)(offsetof(x64CPU, syncFromHostAddress))
 #define CPU_OFFSET_DO_SINGLE_OP_ADDRESS (U32)(offsetof(x64CPU, doSingleOpAddress))
@@ -310,6 +311,12 @@ void X64Asm::writeToRegFromValue(U8 reg, bool isRexReg, U64 value, U8 bytes) {
     }
 }
 
+// same as writeToRegFromValue with 8 bytes, but also records where the address went so that the code can be relocated
+void X64Asm::writeToRegFromHostAddress(U8 reg, bool isRexReg, const void* address, U32 relocationType) {
+    writeToRegFromValue(reg, isRexReg, (U64)address, 8);
+    addRelocation(relocationType);
+}
+
 void X64Asm::writeHostPlusTmp(U8 rm, bool checkG, bool isG8bit, bool isE8bit, U8 tmpReg, bool calculateHostAddress, U8 hostMem) {
     this->rex |= REX_BASE | REX_SIB_INDEX|REX_MOD_RM;    
     setRM(rm, checkG, false, isG8bit, isE8bit);
@@ -1029,6 +1036,19 @@ void X64Asm::checkMemory4k(U8 emulatedAddressReg, bool isRex, bool isWrite, U32
     releaseTmpReg(pageReg);
 }
 #endif
+// The first pass decoded every op in this chunk, so on the second pass the branch targets inside the chunk are known
+U32 X64Asm::getNeededFlags(U32 flags) {
+    if (firstPass && firstPass->currentBlock) {
+        DecodedOp* op = firstPass->currentBlock->getOp(cpu->seg[CS].address + startOfOpIp);
+        if (op && op->inst == currentOp->inst) {
+            limitBlockToChunk(firstPass->currentBlock);
+            return DecodedOp::getNeededFlags(firstPass->currentBlock, op, flags);
+        }
+    }
+    limitBlockToChunk(currentBlock);
+    return DecodedOp::getNeededFlags(currentBlock, currentOp, flags);
+}
+
 void X64Asm::checkMemory(U8 emulatedAddressReg, bool isRex, bool isWrite, U32 width, U8 memReg, bool skipAlignmentCheck, U8 tmpReg) {
 #ifdef BOXEDWINE_4K_PAGE_SIZE
     // fpu and mmx have some stability issues when used in platformThread.cpp / seh_filter
@@ -1040,7 +1060,7 @@ void X64Asm::checkMemory(U8 emulatedAddressReg, bool isRex, bool isWrite, U32 wi
     bool needFlags = false;
 
     if (!flagsWrittenToInstructionStoredFlags) {
-        needFlags = currentOp ? (DecodedOp::getNeededFlags(currentBlock, currentOp, CF | PF | SF | ZF | AF | OF) != 0 || instructionInfo[currentOp->inst].flagsUsed != 0) : true;
+        needFlags = currentOp ? (getNeededFlags(CF | PF | SF | ZF | AF | OF) != 0 || instructionInfo[currentOp->inst].flagsUsed != 0) : true;
     }
     if (!skipAlignmentCheck && width != 1 && width != 2 && width != 4 && width != 8 && width != 16) {
         //needFlags = true;
@@ -1959,6 +1979,21 @@ void X64Asm::createCodeForDoSingleOp() {
     callHost((void*)common_runSingleOp);
     writeToRegFromReg(0, true, 0, false, 8);
     syncRegsToHost();
+
+    // a syscall can ask the thread to go back to the start of its loop, for example exit or exec.  The flags the op
+    // produced are already back in the host flags, so the compare must not change them.
+    U8 tmpReg = getTmpReg();
+    writeToRegFromMem(tmpReg, true, HOST_CPU, true, -1, false, 0, CPU_OFFSET_EXIT_TO_START_LOOP, 4, false);
+    doIf(tmpReg, true, 1, [this]() {
+        // jmp [HOST_CPU+returnToLoopAddress]
+        write8(0x41);
+        write8(0xff);
+        write8(0xa0 | HOST_CPU);
+        write32(CPU_OFFSET_RETURN_ADDRESS);
+        }, []() {
+        }, true
+    );
+    releaseTmpReg(tmpReg);
     doJmp(true);
 }
 
@@ -2242,7 +2277,7 @@ void X64Asm::callHost(void* pfn, U8 tmp, bool internal) {
         write8(0x74);
         U32 pos = this->bufferPos;
         write8(0);
-        writeToRegFromValue(tmp, true, (U64)badStack, 8);
+        writeToRegFromHostAddress(tmp, true, (void*)badStack, BT_RELOCATION_IMAGE);
         write8(REX_BASE | REX_64);
         write8(0x83);
         write8(0xEC);
@@ -2259,7 +2294,7 @@ void X64Asm::callHost(void* pfn, U8 tmp, bool internal) {
         write8(0xfc); // cld
     }
     if (pfn) {
-        writeToRegFromValue(tmp, true, (U64)pfn, 8);
+        writeToRegFromHostAddress(tmp, true, pfn, BT_RELOCATION_IMAGE);
     }
 
 #ifdef BOXEDWINE_MSVC
@@ -2497,6 +2532,7 @@ void X64Asm::setPF_onAL(U8 flagReg) {
     write8(REX_BASE | REX_64 | REX_MOD_RM);
     write8(0xb8+tmpReg);
     write64((U64)parity_lookup);
+    addRelocation(BT_RELOCATION_IMAGE);
     
     // or HOST_TMPb, byte ptr [HOST_TMP2]
     write8(REX_BASE | REX_MOD_REG | REX_MOD_RM);
@@ -3306,11 +3342,21 @@ void X64Asm::subRegs(U8 dst, bool isDstRex, U8 src, bool isSrcRex, bool is64) {
 
 // 43 FF 24 CE          jmp         qword ptr[r14 + r9 * 8]
 
-void X64Asm::jmpReg(U8 reg, bool isRex, bool mightNeedCS) {     
+void X64Asm::jmpReg(U8 reg, bool isRex, bool mightNeedCS, bool isReturn) {     
     if (reg != 7 || !isRex) {
         writeToRegFromReg(7, true, reg, isRex, 4);
     }
-    bool needFlags = true; // need to figure out a way to look at both branches we might jump to
+    bool needFlags = true; // the target is computed at runtime or is outside of this chunk, so its use of flags is unknown (see DecodedOp::getNeededFlagsAfterBranch)
+
+    // the caches are keyed by eip without CS, just like the lookup below when CS can be ignored
+    bool useCache = !this->cpu->thread->process->hasSetSeg[CS] && !mightNeedCS;
+    U32 cacheOffset = 0;
+    if (useCache) {
+        cacheOffset = probeIndirectJumpCache(isReturn);
+        // the probe trashed the tmp regs, r15 still holds the eip
+        reg = 7;
+        isRex = true;
+    }
 
     // HOST_TMP2 will hold the page
     // HOST_TMP will hold the offset
@@ -3447,11 +3493,22 @@ void X64Asm::jmpReg(U8 reg, bool isRex, bool mightNeedCS) {
         jmpNativeReg(0, true);
         }, nullptr);
 
-    // will move address to HOST_TMP3 and test that it exists, if it doesn't then we
-    // will catch the exception.  We leave the address/index we need in HOST_TMP
-    // and HOST_TMP2
+    // HOST_TMP2 is holding the flags, so borrow the stack while it holds the slice index
+    if (needFlags) {
+        pushNativeReg(HOST_TMP2, true);
+    }
+    // HOST_TMP2 = offset >> K_EIP_SLICE_SHIFT
+    writeToRegFromReg(HOST_TMP2, true, HOST_TMP, true, 4);
+    shiftRightReg(HOST_TMP2, true, K_EIP_SLICE_SHIFT);
 
-    // HOST_TMP3 = cpu->opToAddressPages[page][offset]
+    // HOST_TMP3 = cpu->opToAddressPages[page][slice], already adjusted so that it can be indexed by the offset
+    // mov HOST_TMP3, [HOST_TMP3 + HOST_TMP2 << 3]
+    writeToRegFromMem(HOST_TMP3, true, HOST_TMP3, true, HOST_TMP2, true, 3, 0, 8, false);
+    if (needFlags) {
+        popNativeReg(HOST_TMP2, true);
+    }
+
+    // HOST_TMP3 = cpu->opToAddressPages[page][slice][offset]
     // mov HOST_TMP3, [HOST_TMP3 + HOST_TMP << 3]
     writeToRegFromMem(HOST_TMP3, true, HOST_TMP3, true, HOST_TMP, true, 3, 0, 8, false);
 
@@ -3465,11 +3522,195 @@ void X64Asm::jmpReg(U8 reg, bool isRex, bool mightNeedCS) {
     if (needFlags) {
         popFlagsFromReg(HOST_TMP2, true, true);
     }      
+    if (useCache) {
+        cacheIndirectJumpTarget(cacheOffset, isReturn);
+    }
 
     // jmp HOST_TMP
     jmpNativeReg(HOST_TMP3, true);
 }
 
+static U32 indirectJumpSiteHash(U32 eip) {
+    return eip ^ (eip >> 8) ^ (eip >> 16);
+}
+
+#ifdef _DEBUG
+class X64IndirectJumpSite {
+public:
+    U32 eip = 0;
+    bool isReturn = false;
+    U64 hits = 0;
+    U64 misses = 0;
+};
+
+static BOXEDWINE_MUTEX indirectJumpSitesMutex;
+static BHashTable<U64, X64IndirectJumpSite*> indirectJumpSites;
+
+static X64IndirectJumpSite* getIndirectJumpSite(U32 eip, bool isReturn) {
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(indirectJumpSitesMutex);
+    U64 key = eip | ((U64)isReturn << 32);
+    X64IndirectJumpSite* result = nullptr;
+    if (!indirectJumpSites.get(key, result)) {
+        // never freed, the translated code holds on to the counters
+        result = new X64IndirectJumpSite();
+        result->eip = eip;
+        result->isReturn = isReturn;
+        indirectJumpSites.set(key, result);
+    }
+    return result;
+}
+
+BString X64Asm::getIndirectJumpStats() {
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(indirectJumpSitesMutex);
+    U64 hits[2] = { 0 };
+    U64 total[2] = { 0 };
+    X64IndirectJumpSite* worst = nullptr;
+
+    for (auto& it : indirectJumpSites) {
+        X64IndirectJumpSite* site = it.value;
+        hits[site->isReturn ? 1 : 0] += site->hits;
+        total[site->isReturn ? 1 : 0] += site->hits + site->misses;
+        if (!worst || site->misses > worst->misses) {
+            worst = site;
+        }
+    }
+    BString result = B("jmp cache ");
+    result.append(total[0] ? (U32)(hits[0] * 100 / total[0]) : 0);
+    result.append("% ret cache ");
+    result.append(total[1] ? (U32)(hits[1] * 100 / total[1]) : 0);
+    result.append("%");
+    if (worst && worst->misses) {
+        result.append(" worst ");
+        result.append(worst->eip, 16);
+    }
+    return result;
+}
+
+// the translated code can't touch the flags, so no inc
+void X64Asm::countIndirectJump(U64* counter, U8 addressReg, U8 valueReg) {
+    writeToRegFromHostAddress(addressReg, true, counter, BT_RELOCATION_NONE);
+    writeToRegFromMem(valueReg, true, addressReg, true, -1, false, 0, 0, 8, false);
+    addWithLea(valueReg, true, valueReg, true, -1, false, 0, 1, 8);
+    writeToMemFromReg(valueReg, true, addressReg, true, -1, false, 0, 0, 8, false);
+}
+#endif
+
+// r15 holds the eip.  On a hit this jumps straight to the cached host address, on a miss it falls through with the
+// flags intact and HOST_TMP, HOST_TMP2 and HOST_TMP3 trashed.  Returns what cacheIndirectJumpTarget needs to fill
+// the cache after the lookup.
+//
+// A ret uses the entry pushed by its call (pushReturnPrediction), everything else uses the entries for this site.
+U32 X64Asm::probeIndirectJumpCache(bool isReturn) {
+    U32 eip = this->cpu->seg[CS].address + this->startOfOpIp;
+    U32 siteOffset = CPU_OFFSET_INDIRECT_JUMP_CACHE + (indirectJumpSiteHash(eip) & (X64_INDIRECT_JUMP_CACHE_SIZE - 1)) * X64_INDIRECT_JUMP_CACHE_WAYS * sizeof(X64IndirectJumpCacheEntry);
+    std::vector<U32> misses;
+#ifdef _DEBUG
+    X64IndirectJumpSite* site = getIndirectJumpSite(eip, isReturn);
+#endif
+
+    pushFlagsToReg(HOST_TMP2, true, true);
+
+    if (isReturn) {
+        // HOST_TMP = cpu->returnStack[cpu->returnStackPos--]
+        writeToRegFromMem(HOST_TMP3, true, HOST_CPU, true, -1, false, 0, CPU_OFFSET_RETURN_STACK_POS, 4, false);
+        writeToRegFromMem(HOST_TMP, true, HOST_CPU, true, HOST_TMP3, true, 2, CPU_OFFSET_RETURN_STACK, 4, false);
+        addWithLea(HOST_TMP3, true, HOST_TMP3, true, -1, false, 0, -1, 4);
+        zeroExtend8to32(HOST_TMP3, true, HOST_TMP3, true);
+        writeToMemFromReg(HOST_TMP3, true, HOST_CPU, true, -1, false, 0, CPU_OFFSET_RETURN_STACK_POS, 4, false);
+        writeToMemFromReg(HOST_TMP, true, HOST_CPU, true, -1, false, 0, CPU_OFFSET_PENDING_RETURN_CACHE, 4, false);
+    }
+
+    // HOST_TMP3 = cpu->pendingCodeEpoch = *cpu->codeEpoch, it is read before the lookup so that if the result is
+    // released while it is being cached the entry will already be stale
+    writeToRegFromMem(HOST_TMP3, true, HOST_CPU, true, -1, false, 0, CPU_OFFSET_CODE_EPOCH, 8, false);
+    writeToRegFromMem(HOST_TMP3, true, HOST_TMP3, true, -1, false, 0, 0, 4, false);
+    writeToMemFromReg(HOST_TMP3, true, HOST_CPU, true, -1, false, 0, CPU_OFFSET_PENDING_CODE_EPOCH, 4, false);
+
+    U32 ways = isReturn ? 1 : X64_INDIRECT_JUMP_CACHE_WAYS;
+    for (U32 way = 0; way < ways; way++) {
+        S8 indexReg = isReturn ? HOST_TMP : -1;
+        U32 entry = isReturn ? CPU_OFFSET_RETURN_CACHE : siteOffset + way * sizeof(X64IndirectJumpCacheEntry);
+
+        // cmp r15d, entry->eip
+        doMemoryInstruction(0x3b, 7, true, HOST_CPU, true, indexReg, true, 0, entry + offsetof(X64IndirectJumpCacheEntry, eip), 4);
+        // jne miss
+        write8(0x0f);
+        write8(0x85);
+        misses.push_back(this->bufferPos);
+        write32(0);
+
+        // cmp HOST_TMP3, entry->epoch
+        doMemoryInstruction(0x3b, HOST_TMP3, true, HOST_CPU, true, indexReg, true, 0, entry + offsetof(X64IndirectJumpCacheEntry, epoch), 4);
+        // jne miss
+        write8(0x0f);
+        write8(0x85);
+        misses.push_back(this->bufferPos);
+        write32(0);
+
+        // hit
+        if (isReturn) {
+            writeToRegFromMem(HOST_TMP3, true, HOST_CPU, true, HOST_TMP, true, 0, entry + offsetof(X64IndirectJumpCacheEntry, host), 8, false);
+        } else {
+            writeToRegFromMem(HOST_TMP3, true, HOST_CPU, true, -1, false, 0, entry + offsetof(X64IndirectJumpCacheEntry, host), 8, false);
+        }
+        popFlagsFromReg(HOST_TMP2, true, true);
+#ifdef _DEBUG
+        countIndirectJump(&site->hits, HOST_TMP, HOST_TMP2);
+#endif
+        jmpNativeReg(HOST_TMP3, true);
+
+        for (U32 pos : misses) {
+            write32Buffer(&this->buffer[pos], this->bufferPos - pos - 4);
+        }
+        misses.clear();
+    }
+#ifdef _DEBUG
+    countIndirectJump(&site->misses, HOST_TMP, HOST_TMP3);
+#endif
+    popFlagsFromReg(HOST_TMP2, true, true);
+    return siteOffset;
+}
+
+// HOST_TMP3 holds the host address that the lookup found for r15, HOST_TMP and HOST_TMP2 are free.  None of this can
+// touch the flags.
+void X64Asm::cacheIndirectJumpTarget(U32 siteOffset, bool isReturn) {
+    U32 entry;
+    S8 indexReg = -1;
+
+    if (isReturn) {
+        // HOST_TMP = offset of the entry the call pushed
+        writeToRegFromMem(HOST_TMP, true, HOST_CPU, true, -1, false, 0, CPU_OFFSET_PENDING_RETURN_CACHE, 4, false);
+        indexReg = HOST_TMP;
+        entry = CPU_OFFSET_RETURN_CACHE;
+    } else {
+        // age the most recent target into the second way
+        for (U32 i = 0; i < sizeof(X64IndirectJumpCacheEntry); i += 8) {
+            writeToRegFromMem(HOST_TMP, true, HOST_CPU, true, -1, false, 0, siteOffset + i, 8, false);
+            writeToMemFromReg(HOST_TMP, true, HOST_CPU, true, -1, false, 0, siteOffset + sizeof(X64IndirectJumpCacheEntry) + i, 8, false);
+        }
+        entry = siteOffset;
+    }
+    writeToMemFromReg(7, true, HOST_CPU, true, indexReg, true, 0, entry + offsetof(X64IndirectJumpCacheEntry, eip), 4, false);
+    writeToRegFromMem(HOST_TMP2, true, HOST_CPU, true, -1, false, 0, CPU_OFFSET_PENDING_CODE_EPOCH, 4, false);
+    writeToMemFromReg(HOST_TMP2, true, HOST_CPU, true, indexReg, true, 0, entry + offsetof(X64IndirectJumpCacheEntry, epoch), 4, false);
+    writeToMemFromReg(HOST_TMP3, true, HOST_CPU, true, indexReg, true, 0, entry + offsetof(X64IndirectJumpCacheEntry, host), 8, false);
+}
+
+// call sites push which returnCache entry their ret should check, without touching the flags
+void X64Asm::pushReturnPrediction() {
+    U32 eip = this->cpu->seg[CS].address + this->startOfOpIp;
+    U32 entry = (indirectJumpSiteHash(eip) & (X64_RETURN_CACHE_SIZE - 1)) * sizeof(X64IndirectJumpCacheEntry);
+    U8 tmpReg = getTmpReg();
+
+    // cpu->returnStack[++cpu->returnStackPos] = entry
+    writeToRegFromMem(tmpReg, true, HOST_CPU, true, -1, false, 0, CPU_OFFSET_RETURN_STACK_POS, 4, false);
+    addWithLea(tmpReg, true, tmpReg, true, -1, false, 0, 1, 4);
+    zeroExtend8to32(tmpReg, true, tmpReg, true);
+    writeToMemFromReg(tmpReg, true, HOST_CPU, true, -1, false, 0, CPU_OFFSET_RETURN_STACK_POS, 4, false);
+    writeToMemFromValue(entry, HOST_CPU, true, tmpReg, true, 2, CPU_OFFSET_RETURN_STACK, 4, false);
+    releaseTmpReg(tmpReg);
+}
+
 void X64Asm::jmpNativeReg(U8 reg, bool isRegRex) {
     if (isRegRex)
         write8(REX_BASE | REX_MOD_RM);
@@ -3486,6 +3727,14 @@ void X64Asm::zeroExtend16to32(U8 reg, bool isRegRex, U8 fromReg, bool isFromRex)
     write8(0xc0 | (reg << 3) | fromReg);
 }
 
+void X64Asm::zeroExtend8to32(U8 reg, bool isRegRex, U8 fromReg, bool isFromRex) {
+    // always use a rex prefix so that 4-7 are spl, bpl, sil and dil instead of ah, ch, dh and bh
+    write8(REX_BASE | (isFromRex ? REX_MOD_RM : 0) | (isRegRex ? REX_MOD_REG : 0));
+    write8(0x0f);
+    write8(0xb6);
+    write8(0xc0 | (reg << 3) | fromReg);
+}
+
 void X64Asm::retn16(U32 bytes) {
     U32 tmpReg = getTmpReg();
     popReg16(tmpReg, true);
@@ -3494,7 +3743,7 @@ void X64Asm::retn16(U32 bytes) {
     if (bytes) {
         addWithLea(HOST_ESP, true, HOST_ESP, true, -1, false, 0, bytes, 2);
     }
-    jmpReg(tmpReg, true, false);
+    jmpReg(tmpReg, true, false, true);
     releaseTmpReg(tmpReg);
 }
 
@@ -3504,7 +3753,7 @@ void X64Asm::retn32(U32 bytes) {
     if (bytes) {
         addWithLea(HOST_ESP, true, HOST_ESP, true, -1, false, 0, bytes, 4);
     }
-    jmpReg(tmpReg, true, false);
+    jmpReg(tmpReg, true, false, true);
     releaseTmpReg(tmpReg);
 }
 
@@ -3553,32 +3802,10 @@ void X64Asm::logOp(U32 eip) {
     syncRegsToHost();
 }
 
+// the syscall isn't called from the chunk, a thread can wait in it long enough for the chunk to be retired and freed, see
+// common_runSingleOp.  The doSingleOp stub looks up where to go next when it returns.
 void X64Asm::syscall(U32 opLen) {
-    syncRegsFromHost();  
-
-    lockParamReg(PARAM_1_REG, PARAM_1_REX);
-    writeToRegFromReg(PARAM_1_REG, PARAM_1_REX, HOST_CPU, true, 8); // CPU* param
-
-    writeToRegFromValue(PARAM_2_REG, PARAM_2_REX, (U64)currentOp, 8);
-    writeToMemFromReg(PARAM_2_REG, PARAM_2_REX, HOST_CPU, true, -1, false, 0, CPU_OFFSET_CURRENT_OP, 8, false);
-    writeToMemFromValue(0, HOST_CPU, true, -1, false, 0, CPU_OFFSET_ARG5, 4, false);
-    callHost((void*)common_runSingleOp);
-
-    syncRegsToHost();
-	
-	U8 tmpReg = getTmpReg();
-	writeToRegFromMem(tmpReg, true, HOST_CPU, true, -1, false, 0, CPU_OFFSET_EXIT_TO_START_LOOP, 4, false);
-	doIf(tmpReg, true, 1, [this]() {
-		// jmp [HOST_CPU+returnToLoopAddress]
-		write8(0x41);
-		write8(0xff);
-		write8(0xa0 | HOST_CPU);
-		write32(CPU_OFFSET_RETURN_ADDRESS);
-		}, []() {
-		}
-	);
-	releaseTmpReg(tmpReg);
-    doJmp(true);
+    emulateSingleOp(currentOp);
 }
 
 void X64Asm::int99(U32 opLen) {
@@ -3675,6 +3902,7 @@ void X64Asm::callE(bool big, U8 rm) {
         zeroExtend16to32(tmpReg, true, tmpReg, true);
     }
     push(-1, false, this->ip, (big?4:2)); 
+    pushReturnPrediction();
     jmpReg(tmpReg, true, false);
     releaseTmpReg(tmpReg);
 }
@@ -3757,7 +3985,7 @@ static void x64_errorMsg(const char* msg) {
 void X64Asm::errorMsg(const char* msg) {
     //syncRegsFromHost(); 
     lockParamReg(PARAM_1_REG, PARAM_1_REX);
-    writeToRegFromValue(PARAM_1_REG, PARAM_1_REX, (U64)msg, 8);
+    writeToRegFromHostAddress(PARAM_1_REG, PARAM_1_REX, msg, BT_RELOCATION_IMAGE);
     callHost((void*)x64_errorMsg);
     //syncRegsToHost();
     //doJmp();
@@ -3885,7 +4113,7 @@ void x64_stringNoArgs(x64CPU* cpu, pfnStringNoArgs pfn, U32 size) {
 }
 
 void X64Asm::emulateSingleOp(DecodedOp* op, bool dynamic) {
-    writeToRegFromValue(HOST_TMP, true, (U64)op, 8);
+    writeToRegFromHostAddress(HOST_TMP, true, op, BT_RELOCATION_OP);
     writeToMemFromReg(HOST_TMP, true, HOST_CPU, true, -1, false, 0, CPU_OFFSET_CURRENT_OP, 8, false);
     writeToRegFromValue(HOST_TMP, true, startOfOpIp, 4);
     writeToMemFromValue(dynamic ? 1 : 0, HOST_CPU, true, -1, false, 0, CPU_OFFSET_ARG5, 4, false);    
@@ -3894,7 +4122,7 @@ void X64Asm::emulateSingleOp(DecodedOp* op, bool dynamic) {
 }
 
 void X64Asm::clearDirectionFlag() {
-    bool needFlags = currentOp ? (DecodedOp::getNeededFlags(currentBlock, currentOp, CF | PF | SF | ZF | AF | OF) != 0 || instructionInfo[currentOp->inst].flagsUsed != 0) : true;
+    bool needFlags = currentOp ? (getNeededFlags(CF | PF | SF | ZF | AF | OF) != 0 || instructionInfo[currentOp->inst].flagsUsed != 0) : true;
     U8 flagsReg = getTmpReg();
     if (needFlags) {
         pushFlagsToReg(flagsReg, true, true);
@@ -3911,7 +4139,7 @@ void X64Asm::clearDirectionFlag() {
 }
 
 void X64Asm::setDirectionFlag() {
-    bool needFlags = currentOp ? (DecodedOp::getNeededFlags(currentBlock, currentOp, CF | PF | SF | ZF | AF | OF) != 0 || instructionInfo[currentOp->inst].flagsUsed != 0) : true;
+    bool needFlags = currentOp ? (getNeededFlags(CF | PF | SF | ZF | AF | OF) != 0 || instructionInfo[currentOp->inst].flagsUsed != 0) : true;
     U8 flagsReg = getTmpReg();
     if (needFlags) {
         pushFlagsToReg(flagsReg, true, true);
@@ -3940,7 +4168,7 @@ void X64Asm::setDirectionFlag() {
 // }
 void X64Asm::string(U32 width, bool hasSrc, bool hasDst) {
     bool repeat = (currentOp->repZero || currentOp->repNotZero);
-    bool needFlags = currentOp ? (DecodedOp::getNeededFlags(currentBlock, currentOp, CF | PF | SF | ZF | AF | OF) != 0 || instructionInfo[currentOp->inst].flagsUsed != 0) : true;
+    bool needFlags = currentOp ? (getNeededFlags(CF | PF | SF | ZF | AF | OF) != 0 || instructionInfo[currentOp->inst].flagsUsed != 0) : true;
     U32 skipPos = 0;
 
     if (needFlags) {
@@ -4129,7 +4357,7 @@ void X64Asm::string(U32 width, bool hasSrc, bool hasDst) {
 void X64Asm::cmps(U32 width, bool hasSrc) {
     bool repeat = (currentOp->repZero || currentOp->repNotZero);
     U32 skipPos = 0;
-    bool needFlags = currentOp ? (DecodedOp::getNeededFlags(currentBlock, currentOp, CF | PF | SF | ZF | AF | OF) != 0 || instructionInfo[currentOp->inst].flagsUsed != 0) : true;
+    bool needFlags = currentOp ? (getNeededFlags(CF | PF | SF | ZF | AF | OF) != 0 || instructionInfo[currentOp->inst].flagsUsed != 0) : true;
 
     if (needFlags) {
         U8 flagsReg = getTmpReg();
@@ -4354,7 +4582,7 @@ void X64Asm::callFpuWithAddressWrite(PFN_FPU_ADDRESS pfn, U8 rm, U32 len) {
     writeToRegFromReg(PARAM_1_REG, PARAM_1_REX, HOST_CPU, true, 8); // CPU* param
 
     lockParamReg(PARAM_2_REG, PARAM_2_REX);
-    writeToRegFromValue(PARAM_2_REG, PARAM_2_REX, (U64)pfn, 8);
+    writeToRegFromHostAddress(PARAM_2_REG, PARAM_2_REX, (void*)pfn, BT_RELOCATION_IMAGE);
 
     lockParamReg(PARAM_4_REG, PARAM_4_REX);
     writeToRegFromValue(PARAM_4_REG, PARAM_4_REX, len, 4);
@@ -4386,7 +4614,7 @@ void X64Asm::saveNativeState() {
 		pushNativeReg(i, true);
 	}
 
-	writeToRegFromValue(HOST_CPU, true, (U64)this->cpu, 8);
+	writeToRegFromHostAddress(HOST_CPU, true, this->cpu, BT_RELOCATION_NONE);
 
 	// fxsave cpu->fpuState
 	write8(0x41);
@@ -4446,9 +4674,58 @@ void X64Asm::createCodeForRetranslateChunk(bool includeSetupFromR9) {
     jmpNativeReg(HOST_TMP, true);
 }
 
+static void x64_retranslateHotChunk() {
+    x64CPU* cpu = ((x64CPU*)KThread::currentThread()->cpu);
+    cpu->returnHostAddress = cpu->retranslateHotChunk();
+}
+
+// eip is in R9
+void X64Asm::createCodeForRetranslateHotChunk() {
+    syncRegsFromHost(true);
+    callHost((void*)x64_retranslateHotChunk);
+    syncRegsToHost();
+    writeToRegFromMem(HOST_TMP, true, HOST_CPU, true, -1, false, 0, CPU_OFFSET_RETURN_HOST_ADDRESS, 8, false);
+    jmpNativeReg(HOST_TMP, true);
+}
+
+// Emitted before the first instruction of a chunk, jumps back to the start of the chunk are counted too.  The guest
+// flags are live in the host flags here, jrcxz is the only conditional jump that doesn't need them so ECX is borrowed
+// to hold the count.
+void X64Asm::countChunkEntry() {
+    writeToRegFromReg(HOST_TMP2, true, 1, false, 8);
+    writeToRegFromHostAddress(HOST_TMP, true, &currentBlock->runCount, BT_RELOCATION_BLOCK);
+    writeToRegFromMem(1, false, HOST_TMP, true, -1, false, 0, 0, 4, false);
+    addWithLea(1, false, 1, false, -1, false, 0, 1, 4);
+    writeToMemFromReg(1, false, HOST_TMP, true, -1, false, 0, 0, 4, false);
+    addWithLea(1, false, 1, false, -1, false, 0, -X64_HOT_CHUNK_RUN_COUNT, 4);
+
+    // jrcxz hot
+    write8(0xe3);
+    write8(0);
+    U32 hotPos = this->bufferPos;
+    writeToRegFromReg(1, false, HOST_TMP2, true, 8);
+    // jmp done
+    write8(0xeb);
+    write8(0);
+    U32 donePos = this->bufferPos;
+    this->buffer[hotPos - 1] = (U8)(this->bufferPos - hotPos);
+
+    // hot:
+    writeToRegFromReg(1, false, HOST_TMP2, true, 8);
+    writeToRegFromValue(HOST_TMP, true, this->startOfDataIp, 4);
+    writeToRegFromMem(HOST_TMP2, true, HOST_CPU, true, -1, false, 0, CPU_OFFSET_RETRANSLATE_HOT_CHUNK_ADDRESS, 8, false);
+    jmpNativeReg(HOST_TMP2, true);
+    if (this->bufferPos - donePos > 127) {
+        kpanic("X64Asm::countChunkEntry bad jmp");
+    }
+    this->buffer[donePos - 1] = (U8)(this->bufferPos - donePos);
+    // done:
+}
+
 static void x64_jmpAndTranslateIfNecessary() {
     x64CPU* cpu = ((x64CPU*)KThread::currentThread()->cpu);
     KMemoryData* mem = getMemData(cpu->memory);
+    cpu->leftTranslatedCode();
     try {
         while (true) {
             U32 address = cpu->eip.u32 + cpu->seg[CS].address;
@@ -4470,6 +4747,7 @@ static void x64_jmpAndTranslateIfNecessary() {
 
 static void x64_jmpAndTranslateIfNecessaryAdjustForCS() {
     x64CPU* cpu = ((x64CPU*)KThread::currentThread()->cpu);
+    cpu->leftTranslatedCode();
     cpu->eip.u32 -= cpu->seg[CS].address;
     if (!cpu->isBig()) {
         cpu->eip.u32 = cpu->eip.u32 & 0xFFFF;
@@ -55,6 +55,13 @@
 #define CPU_OFFSET_FPU_TAG (U32)(offsetof(CPU, fpu.tags[0]))
 #define CPU_OFFSET_FPU_SW (U32)(offsetof(CPU, fpu.sw))
 #define CPU_OFFSET_INSTRUCTION_FLAGS (U32)(offsetof(x64CPU, instructionStoredFlags))
+#define CPU_OFFSET_INDIRECT_JUMP_CACHE (U32)(offsetof(x64CPU, indirectJumpCache))
+#define CPU_OFFSET_RETURN_CACHE (U32)(offsetof(x64CPU, returnCache))
+#define CPU_OFFSET_RETURN_STACK (U32)(offsetof(x64CPU, returnStack))
+#define CPU_OFFSET_RETURN_STACK_POS (U32)(offsetof(x64CPU, returnStackPos))
+#define CPU_OFFSET_PENDING_CODE_EPOCH (U32)(offsetof(x64CPU, pendingCodeEpoch))
+#define CPU_OFFSET_CODE_EPOCH (U32)(offsetof(x64CPU, codeEpoch))
+#define CPU_OFFSET_PENDING_RETURN_CACHE (U32)(offsetof(x64CPU, pendingReturnCacheOffset))
 
 typedef void (*PFN_FPU_REG)(CPU* cpu, U32 reg);
 typedef void (*PFN_FPU_ADDRESS)(CPU* cpu, U32 address);
@@ -77,10 +84,15 @@ public:
 	void saveNativeState();
 	void restoreNativeState();
     void createCodeForRetranslateChunk(bool includeSetupFromR9=false);
+    void createCodeForRetranslateHotChunk();
     void createCodeForJmpAndTranslateIfNecessary(bool includeSetupFromR9 = false);
     void createCodeForSyncToHost();
     void createCodeForSyncFromHost();    
     void callRetranslateChunk();
+    void countChunkEntry();
+#ifdef _DEBUG
+    static BString getIndirectJumpStats();
+#endif
 #ifdef BOXEDWINE_POSIX
     void createCodeForRunSignal();
 #endif
@@ -148,6 +160,7 @@ public:
     void bswapEsp();
     void bswapSp();
     void writeToRegFromValue(U8 reg, bool isRexReg, U64 value, U8 bytes);
+    void writeToRegFromHostAddress(U8 reg, bool isRexReg, const void* address, U32 relocationType);
     void enter(bool big, U32 bytes, U32 level);
     void leave(bool big);
     void callE(bool big, U8 rm);
@@ -254,7 +267,13 @@ public:
     void addTodoLinkJump(U32 eip);       
     void doLoop(U32 eip);
     void doLoop16(U8 inst, U32 eip);
-    void jmpReg(U8 reg, bool isRex, bool mightNeedCS);
+    void jmpReg(U8 reg, bool isRex, bool mightNeedCS, bool isReturn = false);
+    U32 probeIndirectJumpCache(bool isReturn);
+    void cacheIndirectJumpTarget(U32 siteOffset, bool isReturn);
+    void pushReturnPrediction();
+#ifdef _DEBUG
+    void countIndirectJump(U64* counter, U8 addressReg, U8 valueReg);
+#endif
     void jmpNativeReg(U8 reg, bool isRegRex);
     void shiftRightReg(U8 reg, bool isRegRex, U8 shiftAmount, bool arith = false, bool is64bit = false);
     void shiftLeftReg(U8 reg, bool isRegRex, U8 shiftAmount);
@@ -270,6 +289,7 @@ public:
     void writeToRegFromE(U8 reg, bool isRegRex, U8 rm, U8 bytes); // will trash current op data
     void getAddressInRegFromE(U8 reg, bool isRegRex, U8 rm, bool calculateHostAddress = false); // will trash current op data    
     void zeroExtend16to32(U8 reg, bool isRegRex, U8 fromReg, bool isFromRex);
+    void zeroExtend8to32(U8 reg, bool isRegRex, U8 fromReg, bool isFromRex);
     void xorReg(U8 reg, bool isRegRex, U64 value, bool is64bit);
     void xorRegReg(U8 reg, bool isRegRex, U8 reg2, bool isReg2Rex, bool is64bit);
     void testReg(U8 reg, bool isRegRex, U64 value, bool is64bit);
@@ -297,6 +317,7 @@ public:
     void checkMemory4k(U8 emulatedAddressReg, bool isRex, bool isWrite, U32 width, U8 memReg, bool skipAlignmentCheck, U8 tmpReg = 0xff);
 #endif
     void checkMemory(U8 emulatedAddressReg, bool isRex, bool isWrite, U32 width, U8 memReg, bool skipAlignmentCheck, U8 tmpReg = 0xff);
+    U32 getNeededFlags(U32 flags);
 public:
     void lods(U32 width) {
         string(width, true, false);
@@ -72,7 +72,7 @@ void* x64CPU::init() {
 
     //data.writeToRegFromValue(HOST_CPU, true, (U64)this, 8);
     KMemoryData* memData = getMemData(memory);
-    data.writeToRegFromValue(HOST_MEM_READ, true, (U64)memData->mmuReadPtrAdjusted, 8);
+    data.writeToRegFromHostAddress(HOST_MEM_READ, true, memData->mmuReadPtrAdjusted, BT_RELOCATION_NONE);
     data.setNativeFlags(this->flags, FMASK_TEST|DF);
 
     data.writeToRegFromValue(0, false, EAX, 4);
@@ -90,7 +90,14 @@ void* x64CPU::init() {
     void* result = chunk->getHostAddress();
     //link(&data, chunk);
     this->pendingCodePages.clear();    
-    this->eipToHostInstructionPages = mem->eipToHostInstructionPages;
+    this->eipToHostInstructionPages = (U8****)mem->eipToHostInstructionPages;
+    this->codeEpoch = &mem->codeEpoch;
+    // after exec the cached host addresses are from the old memory, its epoch says nothing about them
+    if (this->cacheMemory != memory) {
+        this->cacheMemory = memory;
+        memset(this->indirectJumpCache, 0, sizeof(this->indirectJumpCache));
+        memset(this->returnCache, 0, sizeof(this->returnCache));
+    }
 
     if (!this->thread->process->returnToLoopAddress) {
         X64Asm returnData(this);
@@ -109,6 +116,13 @@ void* x64CPU::init() {
         this->thread->process->reTranslateChunkAddress = chunk3->getHostAddress();
     }
     this->reTranslateChunkAddress = this->thread->process->reTranslateChunkAddress;
+    if (!this->thread->process->retranslateHotChunkAddress) {
+        X64Asm translateData(this);
+        translateData.createCodeForRetranslateHotChunk();
+        std::shared_ptr<BtCodeChunk> chunk3 = translateData.commit(true);
+        this->thread->process->retranslateHotChunkAddress = chunk3->getHostAddress();
+    }
+    this->retranslateHotChunkAddress = this->thread->process->retranslateHotChunkAddress;
     if (!this->thread->process->syncToHostAddress) {
         X64Asm translateData(this);
         translateData.createCodeForSyncToHost();
@@ -267,37 +281,22 @@ void x64CPU::translateData(BtData* data, BtData* firstPass) {
         if (!data->currentOp) {
             U32 address = this->seg[CS].address + data->ip;
             DecodedBlock* prev = data->currentBlock;
+            // always decode a new block instead of using the one from a chunk that already contains this address, this
+            // might be running without KMemory::mutex and that chunk, along with its block, can be released at any time
+            data->currentBlock = NormalCPU::getBlockForInspectionButNotUsed(this, address, big);
             if (prev) {
-                data->currentBlock = nullptr; // don't chain to an existing block
-            } else {
-                std::shared_ptr<BtCodeChunk> chunk = memory->findCodeBlockContaining(address, 1);
-                if (chunk) {
-                    data->currentBlock = chunk->block;
-                    if (data->currentBlock) {
-                        data->currentOp = data->currentBlock->getOp(address);
-                        if (!data->currentOp) {
-                            // winfish seems to jump into the middle of an instruction which changes it from cmp to mov
-                            data->currentBlock = nullptr;
-                        }
-                    } else {
-                        int ii = 0;
-                    }
-                }
-            }
-            if (!data->currentBlock) {
-                data->currentBlock = NormalCPU::getBlockForInspectionButNotUsed(this, address, big);
-                if (prev) {
-                    prev->bytes += data->currentBlock->bytes;
-                    prevOp->next = data->currentBlock->op;
+                prev->bytes += data->currentBlock->bytes;
+                prevOp->next = data->currentBlock->op;
+                prev->clearNeededFlagsCache();
 
-                    data->currentBlock->op = nullptr;
-                    data->currentBlock->dealloc(false);
-                    data->currentBlock = prev;
-                }
+                data->currentBlock->op = nullptr;
+                data->currentBlock->dealloc(false);
+                data->currentBlock = prev;
             }
             data->currentOp = data->currentBlock->getOp(address);
         }
-        if (hostAddress) {
+        // a superblock translates through code that is already mapped, the chunks it covers are retired when it is published
+        if (hostAddress && !data->superblock) {
             data->jumpTo(data->ip);
             break;
         }
@@ -319,7 +318,13 @@ void x64CPU::translateData(BtData* data, BtData* firstPass) {
         }
 #endif
         data->mapAddress(address, data->bufferPos);
+        if (data->ipAddressCount == 1 && !data->superblock) {
+            ((X64Asm*)data)->countChunkEntry();
+        }
         data->translateInstruction();
+        if (data->done && data->continueSuperblock()) {
+            data->done = false;
+        }
         if (data->done || data->currentOp->inst == Invalid) {
             break;
         }
@@ -334,10 +339,14 @@ void x64CPU::translateData(BtData* data, BtData* firstPass) {
 
 extern bool writesFlags[InstructionCount];
 
+// called from the doSingleOp stub, translated code jumps to it instead of calling it so that nothing returns into the chunk
+// afterwards.  This is a safe point, the op can be a syscall that waits for a long time and meanwhile the chunk, along with
+// the DecodedBlock the op is from, can be retired and freed.  So the op is copied before the epoch is updated.
 void common_runSingleOp(x64CPU* cpu) {
     U32 address = cpu->getEipAddress();
     cpu->updateFlagsFromX64();
     DecodedOp* op = cpu->currentSingleOp;
+    DecodedOp savedOp;
     bool deallocOp = false;
     bool dynamic = cpu->arg5 != 0;
     if (dynamic) {
@@ -349,7 +358,12 @@ void common_runSingleOp(x64CPU* cpu) {
         deallocOp = true;
     } else if (!op) {
         kpanic("common_runSingleOp oops");
+    } else {
+        savedOp = *op;
+        op = &savedOp;
     }
+    cpu->currentSingleOp = nullptr;
+    cpu->leftTranslatedCode();
 #ifndef BOXEDWINE_USE_SSE_FOR_FPU
     for (U32 i = 0; i < 8; i++) {
         cpu->xmm[i].pd.u64[0] = cpu->fpuState.xmm[i].low;
@@ -72,6 +72,27 @@ struct FxsaveStruct {
     uint8_t available[48];
 };
 
+// Per thread caches used by X64Asm::jmpReg in front of the eip to host lookup.  An entry is only valid while its epoch
+// matches the BtMemory::codeEpoch of the thread's memory, so nothing has to be flushed when code is released.
+#define X64_INDIRECT_JUMP_CACHE_SIZE 256 // jmp/call sites, hashed by eip
+#define X64_INDIRECT_JUMP_CACHE_WAYS 2 // each site remembers its last 2 targets
+#define X64_RETURN_CACHE_SIZE 256 // call sites, hashed by eip, each remembers where its ret lands
+#define X64_RETURN_STACK_SIZE 256 // must be 256, the position wraps with a byte move so that flags are not touched
+
+// a chunk counts how many times it is entered in its DecodedBlock::runCount, when it reaches this it is translated again
+// as a superblock, see BtCPU::retranslateHotChunk.  Must be less than 128, it is subtracted with an 8-bit displacement.
+#ifdef __TEST
+#define X64_HOT_CHUNK_RUN_COUNT 2
+#else
+#define X64_HOT_CHUNK_RUN_COUNT 50
+#endif
+
+struct X64IndirectJumpCacheEntry {
+    U32 eip;
+    U32 epoch;
+    U8* host;
+};
+
 class x64CPU : public BtCPU {
 public:
     x64CPU(KMemory* memory);
@@ -84,6 +105,7 @@ public:
     void* init() override;
     void link(BtData* data, std::shared_ptr<BtCodeChunk>& fromChunk, U32 offsetIntoChunk = 0) override;
     void translateData(BtData* data, BtData* firstPass = nullptr) override;
+    bool canStoreChunks() override { return true; }
 protected:
     BtData* getData1() override { data1.reset(); return &data1; }
     BtData* getData2() override { data2.reset(); return &data2; }
@@ -101,7 +123,7 @@ public:
     void saveToFxState(U32 inst);
 
     U32 negSegAddress[6] = { 0 };
-	U8*** eipToHostInstructionPages = nullptr;
+	U8**** eipToHostInstructionPages = nullptr;
     U32 arg5 = 0;
     U32 currentHostFlags = 0;
     U32 instructionStoredFlags = 0;
@@ -111,7 +133,16 @@ public:
     U32 sseControlStateTmp2 = 0;
     U64 originalCpuRegs[16] = { 0 };
     void* reTranslateChunkAddress = nullptr;    
+    void* retranslateHotChunkAddress = nullptr;
     void* jmpAndTranslateIfNecessary = nullptr;
+    X64IndirectJumpCacheEntry indirectJumpCache[X64_INDIRECT_JUMP_CACHE_SIZE * X64_INDIRECT_JUMP_CACHE_WAYS] = {};
+    X64IndirectJumpCacheEntry returnCache[X64_RETURN_CACHE_SIZE] = {};
+    U32 returnStack[X64_RETURN_STACK_SIZE] = { 0 }; // byte offsets into returnCache, pushed by call and popped by ret
+    U32 returnStackPos = 0;
+    U32 pendingCodeEpoch = 0; // the epoch read before the table lookup, stored with the result
+    std::atomic<U32>* codeEpoch = nullptr; // BtMemory::codeEpoch of this thread's memory
+    KMemory* cacheMemory = nullptr; // the memory the caches were filled from
+    U32 pendingReturnCacheOffset = 0;
     static bool hasBMI2;
 
 #ifdef _DEBUG
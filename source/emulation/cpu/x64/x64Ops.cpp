@@ -1017,6 +1017,7 @@ static U32 callJw(X64Asm* data) {
     U16 offset = data->fetch16();
     U32 eip = (data->ip+offset) & 0xFFFF;    
     data->pushw(data->ip); // will return to next instruction
+    data->pushReturnPrediction();
     data->jumpTo(eip);
     data->done = true;
     return 0;
@@ -1027,6 +1028,7 @@ static U32 callJd(X64Asm* data) {
     S32 offset = data->fetch32();
     U32 eip = data->ip+offset;    
     data->pushd(data->ip); // will return to next instruction
+    data->pushReturnPrediction();
     data->jumpTo(eip);
     data->done = true;
     return 0;
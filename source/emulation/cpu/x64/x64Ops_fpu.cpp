@@ -76,7 +76,7 @@ public:
 class PushPopFlags {
 public:
 	PushPopFlags(X64Asm* data) : data(data) {
-		needFlags = data->currentOp ? (DecodedOp::getNeededFlags(data->currentBlock, data->currentOp, CF | PF | SF | ZF | AF | OF) != 0 || instructionInfo[data->currentOp->inst].flagsUsed != 0) : true;
+		needFlags = data->currentOp ? (data->getNeededFlags(CF | PF | SF | ZF | AF | OF) != 0 || instructionInfo[data->currentOp->inst].flagsUsed != 0) : true;
 		if (needFlags) {
 			U8 flagsReg = data->getTmpReg();
 			data->pushFlagsToReg(flagsReg, true, true);
@@ -1565,6 +1565,8 @@ void opFNINIT(X64Asm* data) {
 		data->writeToMemFromValue(TAG_Empty, HOST_CPU, true, -1, false, 0, CPU_OFFSET_FPU_TAG + i*sizeof(U32), 4, false);
 	}
 	data->writeToMemFromValue(0, HOST_CPU, true, -1, false, 0, CPU_OFFSET_FPU_IS_MMX, 1, false);
+	// 0x37f is 64-bit precision, see FPU::SetCW
+	data->writeToMemFromValue(0, HOST_CPU, true, -1, false, 0, (U32)(offsetof(CPU, fpu.useF64)), 1, false);
 }
 void opFUCOMI_ST0_STj(X64Asm* data, U8 reg) {
 	U8 topReg = getTopReg(data);
@@ -192,17 +192,19 @@ void CodePageData::addEntry(U32 start, U32 stop, CodePageEntry* entry) {
     }
 }
 
-void CodePageData::removeBlockAt(U32 address, U32 len) {
+void CodePageData::removeBlockAt(U32 address, U32 len, bool isWrite) {
     BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(mutex);
-    nolock_removeBlockAt(address, len);
+    nolock_removeBlockAt(address, len, isWrite);
 }
 
-void CodePageData::nolock_removeBlockAt(U32 address, U32 len) {
+void CodePageData::nolock_removeBlockAt(U32 address, U32 len, bool isWrite) {
     U32 offset = address & K_PAGE_MASK;
     CodePageEntry* entry = findEntry(offset, offset + len - 1);
 
     if (entry) {
-        if (writeCount < DYNAMIC_MAX) {
+        if (!isWrite) {
+            // the code is being replaced, not changed, so it doesn't count towards marking the page dynamic
+        } else if (writeCount < DYNAMIC_MAX) {
             writeCount++;
         } else if (!writeCountsPerByte) {
             writeCountsPerByte = new U8[K_PAGE_SIZE];
@@ -230,6 +232,21 @@ void CodePageData::nolock_removeBlockAt(U32 address, U32 len) {
     }
 }
 
+void CodePageData::removeCode(CodeBlockParam block) {
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(mutex);
+    U32 offset = block->getEip() & K_PAGE_MASK;
+    CodePageEntry* e = entries[offset >> CODE_ENTRIES_SHIFT];
+
+    while (e) {
+        if (e->block == block) {
+            // the entry in the bucket of the start has the links to the other pages
+            removeBlock(e, offset);
+            return;
+        }
+        e = e->nextEntry;
+    }
+}
+
 void CodePageData::addCode(KMemory* memory, U32 eip, CodeBlockParam block, const InternalCodeBlock& sharedBlock, U32 len, CodePageEntry* link) {
     BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(mutex);
     CodePageEntry* entry = freeEntries.get();
@@ -269,8 +286,8 @@ void CodePageData::addCode(KMemory* memory, CodeBlockParam block) {
         KThread* thread = KThread::currentThread();
         if (thread) {
             KMemory* memory = KThread::currentThread()->memory;
-            // check to prevent recursion
-            if (getMemData(memory)->getExistingHostAddress(entry->getEip())) {
+            // check to prevent recursion, retired chunks are freed by BtMemory::freeRetiredCodeChunks
+            if (!entry->retired && getMemData(memory)->getExistingHostAddress(entry->getEip())) {
                 entry->release(memory);
             }
         }
@@ -280,22 +297,7 @@ void CodePageData::addCode(KMemory* memory, CodeBlockParam block) {
     this->addCode(memory, block->getEip(), block, sharedBlock, block->getEipLen(), nullptr);
 }
 
-#ifdef BOXEDWINE_BINARY_TRANSLATOR
-U32 CodePageData::getEipFromHost(U8* host) {
-    for (int i = 0; i < CODE_ENTRIES; i++) {
-        CodePageEntry* entry = entries[i];
-        while (entry) {
-            U32 result = entry->block->getEipThatContainsHostAddress(host, nullptr, nullptr);
-            if (result) {
-                return result;
-            }
-            entry = entry->nextEntry;
-        }
-    }
-    return 0;
-}
-
-#else
+#ifndef BOXEDWINE_BINARY_TRANSLATOR
 CodeBlock CodePageData::getCode(U32 eip) {
     BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(mutex);
     U32 offset = eip & K_PAGE_MASK;
@@ -366,10 +368,17 @@ void CodeCache::addCode(KMemory* memory, CodeBlockParam block) {
     page->addCode(memory, block);
 }
 
-void CodeCache::removeBlockAt(U32 address, U32 len) {
+void CodeCache::removeBlockAt(U32 address, U32 len, bool isWrite) {
     CodePageData* page = getCodePageData(address, false);
     if (page) {
-        page->removeBlockAt(address, len);
+        page->removeBlockAt(address, len, isWrite);
+    }
+}
+
+void CodeCache::removeCode(CodeBlockParam block) {
+    CodePageData* page = getCodePageData(block->getEip(), false);
+    if (page) {
+        page->removeCode(block);
     }
 }
 
@@ -424,21 +433,3 @@ CodePageData* CodeCache::getCodePageData(U32 address, bool create) {
     }
     return result;
 }
-
-#ifdef BOXEDWINE_BINARY_TRANSLATOR
-U32 CodeCache::getEipFromHost(U8* host) {
-    for (U32 i = 0; i < FIRST_INDEX_SIZE; i++) {
-        if (pageData[i]) {
-            for (U32 j = 0; j < SECOND_INDEX_SIZE; j++) {
-                if (pageData[i][j]) {
-                    U32 result = pageData[i][j]->getEipFromHost(host);
-                    if (result) {
-                        return result;
-                    }
-                }
-            }
-        }
-    }
-    return 0;
-}
-#endif
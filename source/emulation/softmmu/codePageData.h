@@ -37,13 +37,12 @@ public:
 
     void addCode(KMemory* memory, CodeBlockParam block);
     CodeBlock findCode(U32 eip, U32 len);
-#ifdef BOXEDWINE_BINARY_TRANSLATOR
-    U32 getEipFromHost(U8* host);
-#else
+#ifndef BOXEDWINE_BINARY_TRANSLATOR
     CodeBlock getCode(U32 eip);
 #endif
 
-    void removeBlockAt(U32 address, U32 len);
+    void removeBlockAt(U32 address, U32 len, bool isWrite = true);
+    void removeCode(CodeBlockParam block);
     bool isOffsetDynamic(U32 offset, U32 len);
     void markOffsetDynamic(U32 offset, U32 len);
 
@@ -87,7 +86,7 @@ private:
     void removeEntry(CodePageEntry* entry, U32 offset);
     CodePageData::CodePageEntry* findEntry(U32 start, U32 stop);
     void addEntry(U32 start, U32 stop, CodePageEntry* entry);
-    void nolock_removeBlockAt(U32 address, U32 len);
+    void nolock_removeBlockAt(U32 address, U32 len, bool isWrite);
 
     CodePageEntry* entries[CODE_ENTRIES];
     BOXEDWINE_MUTEX mutex;
@@ -104,12 +103,11 @@ public:
 
     void addCode(KMemory* memory, CodeBlockParam block);
     CodeBlock findCode(U32 eip, U32 len);
-#ifdef BOXEDWINE_BINARY_TRANSLATOR
-    U32 getEipFromHost(U8* host);
-#else
+#ifndef BOXEDWINE_BINARY_TRANSLATOR
     CodeBlock getCode(U32 eip);
 #endif
-    void removeBlockAt(U32 address, U32 len);
+    void removeBlockAt(U32 address, U32 len, bool isWrite = true); // isWrite is false when code is replaced without being changed
+    void removeCode(CodeBlockParam block); // only this block, removeBlockAt also removes everything that overlaps it
     void markAddressDynamic(U32 address, U32 len);
     bool isAddressDynamic(U32 address, U32 len);
 
@@ -45,16 +45,33 @@ KMemoryData* getMemData(KMemory* memory) {
 }
 
 #ifdef BOXEDWINE_BINARY_TRANSLATOR
-KMemoryData::KMemoryData(KMemory* memory) : BtMemory(memory), memory(memory), mmuReadPtrAdjusted{ 0 }, mmuWritePtrAdjusted{ 0 }
 #ifdef BOXEDWINE_4K_PAGE_SIZE
-, mmuReadPtr{ 0 }
-, mmuWritePtr{ 0 }
+#define K_PAGE_TABLES_SIZE (K_NUMBER_OF_PAGES * (sizeof(MMU) + 4 * sizeof(U8*)))
+#else
+#define K_PAGE_TABLES_SIZE (K_NUMBER_OF_PAGES * (sizeof(MMU) + 2 * sizeof(U8*)))
 #endif
+KMemoryData::KMemoryData(KMemory* memory) : BtMemory(memory), memory(memory), usedRegions{ 0 }
 #else
-KMemoryData::KMemoryData(KMemory* memory) : memory(memory)
+#define K_PAGE_TABLES_SIZE (K_NUMBER_OF_PAGES * sizeof(MMU))
+KMemoryData::KMemoryData(KMemory* memory) : memory(memory), usedRegions{ 0 }
 #endif
 {
-    ::memset(mmu, 0, sizeof(mmu));
+    // the host gives back zero'd memory and will only back the pages of it that get written to
+    pageTablesBlockCount = (U32)((K_PAGE_TABLES_SIZE + 0xFFFF) >> 16);
+    pageTables = Platform::alloc64kBlock(pageTablesBlockCount);
+    U8* next = pageTables;
+#ifdef BOXEDWINE_BINARY_TRANSLATOR
+    mmuReadPtrAdjusted = (U8**)next;
+    mmuWritePtrAdjusted = mmuReadPtrAdjusted + K_NUMBER_OF_PAGES;
+    next = (U8*)(mmuWritePtrAdjusted + K_NUMBER_OF_PAGES);
+#ifdef BOXEDWINE_4K_PAGE_SIZE
+    mmuReadPtr = (U8**)next;
+    mmuWritePtr = mmuReadPtr + K_NUMBER_OF_PAGES;
+    next = (U8*)(mmuWritePtr + K_NUMBER_OF_PAGES);
+#endif
+#endif
+    mmu = (MMU*)next;
+
     if(!callbackRam.value) {
         callbackRam = ramPageAlloc();
         addCallback(onExitSignal);
@@ -72,6 +89,7 @@ KMemoryData::~KMemoryData() {
         delete dynamicMemory;
     }
 #endif
+    Platform::releaseNativeMemory(pageTables, (U64)pageTablesBlockCount << 16);
 }
 
 void KMemoryData::onPageChanged(U32 index) {
@@ -205,6 +223,7 @@ bool KMemoryData::reserveAddress(U32 startingPage, U32 pageCount, U32* result, b
                 U32 pageEndIndex = i + pageCount;
                 for (U32 pageIndex = i; pageIndex < pageEndIndex && pageIndex < K_NUMBER_OF_PAGES; pageIndex++) {
                     mmu[pageIndex].flags = reservedFlag;
+                    setRegionUsed(pageIndex);
                 }
                 return true;
             }
@@ -216,6 +235,11 @@ bool KMemoryData::reserveAddress(U32 startingPage, U32 pageCount, U32* result, b
 
 void KMemoryData::protectPage(KThread* thread, U32 i, U32 permissions) {
     mmu[i].setPermissions(permissions);
+#ifdef BOXEDWINE_BINARY_TRANSLATOR
+    // a translation that was reading this page might have to fault now
+    codeChanged(i << K_PAGE_SHIFT, K_PAGE_SIZE);
+#endif
+    setRegionUsed(i);
     onPageChanged(i);
 }
 
@@ -229,10 +253,28 @@ bool KMemoryData::isPageNative(U32 page) {
 
 void KMemoryData::setPagesInvalid(U32 page, U32 pageCount) {
     BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(memory->mutex);
-    for (U32 i = page; i < page + pageCount; i++) {
-        mmu[i].flags = 0;
-        mmu[i].setPage(this, i, PageType::None, (RamPage)0);
-        onPageChanged(i);
+    U32 endPage = page + pageCount;
+    U32 i = page;
+    while (i < endPage) {
+        U32 region = i >> K_MMU_REGION_SHIFT;
+        U32 regionStart = region << K_MMU_REGION_SHIFT;
+        U32 regionEnd = regionStart + (1 << K_MMU_REGION_SHIFT);
+        U32 end = std::min(endPage, regionEnd);
+
+        if (usedRegions[region]) {
+            for (; i < end; i++) {
+                if (!mmu[i].flags && mmu[i].getPageType() == PageType::None) {
+                    continue; // already empty, don't write to it so that unused parts of the page tables stay untouched
+                }
+                mmu[i].flags = 0;
+                mmu[i].setPage(this, i, PageType::None, (RamPage)0);
+                onPageChanged(i);
+            }
+            if (regionStart >= page && regionEnd <= endPage) {
+                usedRegions[region] = false;
+            }
+        }
+        i = end;
     }
 }
 
@@ -364,6 +406,13 @@ U8* KMemory::getRamPtr(U32 address, U32 len, bool write, bool futex) {
     return result;
 }
 
+U8* KMemory::getDataRamPtr(U32 address, U32 len) {
+    if (data->mmu[address >> K_PAGE_SHIFT].getPageType() == PageType::Code) {
+        return nullptr;
+    }
+    return getRamPtr(address, len, true);
+}
+
 void KMemory::clone(KMemory* from, bool vfork) {
     // don't allow changes to the from pages while we are cloning
     BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(from->mutex);
@@ -373,17 +422,41 @@ void KMemory::clone(KMemory* from, bool vfork) {
         return;
     }
 
-    for (int i = 0; i < 0x100000; i++) {
-        if (mapShared(i)) {
-            data->mmu[i].getPage()->onDemmand(&data->mmu[i], i);
+    // only the regions that have something mapped need to be looked at, the rest of the address space is empty in both
+    for (U32 region = 0; region < K_MMU_REGION_COUNT; region++) {
+        if (from->data->isRegionUsed(region) || data->isRegionUsed(region)) {
+            cloneRegion(from, region);
         }
     }
+}
 
-    ::memcpy(data->mmu, from->data->mmu, sizeof(data->mmu));
+void KMemory::cloneRegion(KMemory* from, U32 region) {
+    U32 startPage = region << K_MMU_REGION_SHIFT;
+    U32 endPage = startPage + (1 << K_MMU_REGION_SHIFT);
+    bool wasUsed = data->isRegionUsed(region);
 
-    for (int i = 0; i < 0x100000; i++) {
+    if (wasUsed) {
+        for (U32 i = startPage; i < endPage; i++) {
+            if (mapShared(i)) {
+                data->mmu[i].getPage()->onDemmand(&data->mmu[i], i);
+            }
+        }
+    }
+
+    ::memcpy(&data->mmu[startPage], &from->data->mmu[startPage], (1 << K_MMU_REGION_SHIFT) * sizeof(MMU));
+    if (from->data->isRegionUsed(region)) {
+        data->setRegionUsed(startPage);
+    }
+
+    for (U32 i = startPage; i < endPage; i++) {
         MMU& mmu = data->mmu[i];
 
+        if (!mmu.flags && mmu.getPageType() == PageType::None) {
+            if (wasUsed) {
+                data->onPageChanged(i); // might have been overwritten with an empty entry
+            }
+            continue;
+        }
         RamPage ramPageIndex = mmu.getRamPageIndex();
         if (ramPageIndex.value) {
             ramPageRetain(ramPageIndex);
@@ -418,6 +491,10 @@ CodeBlock KMemory::findCodeBlockContaining(U32 address, U32 len) {
 }
 
 void KMemory::removeCodeBlock(U32 address, U32 len) {
+#ifdef BOXEDWINE_BINARY_TRANSLATOR
+    // a write to a code page, even if no block was there yet it might be in the middle of being translated
+    data->codeChanged(address, len);
+#endif
     data->codeCache.removeBlockAt(address, len);
 }
 
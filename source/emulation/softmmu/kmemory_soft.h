@@ -21,6 +21,9 @@
 
 class CodePage;
 
+#define K_MMU_REGION_SHIFT 10 // 1024 pages, 4MB of the emulated address space
+#define K_MMU_REGION_COUNT (K_NUMBER_OF_PAGES >> K_MMU_REGION_SHIFT)
+
 #include "codePageData.h"
 #include "soft_mmu.h"
 
@@ -48,20 +51,29 @@ public:
     void execvReset();    
     void onPageChanged(U32 page);
 
+    // a region is marked when one of its pages is set and only unmarked when all of its pages are invalidated,
+    // so anything that walks the whole address space can skip regions that were never used
+    void setRegionUsed(U32 page) {usedRegions[page >> K_MMU_REGION_SHIFT] = true;}
+    bool isRegionUsed(U32 region) {return usedRegions[region];}
+
     KMemory* memory;
 
-    MMU mmu[K_NUMBER_OF_PAGES];
+    // The page tables below cover all K_NUMBER_OF_PAGES pages but they are allocated from the host as untouched memory,
+    // so the host only backs the parts of the tables for address ranges the process actually uses.  Unused parts
+    // all read as the host's shared zero page, which means no entry, so lookups don't need to check for a missing table.
+    MMU* mmu;
 
     CodePage* getOrCreateCodePage(U32 address);
 
     // you need to add the full emulated address to the page to get the host page instead of just an offset
     // this will speed things up in the binary translator
 #ifdef BOXEDWINE_BINARY_TRANSLATOR
-    U8* mmuReadPtrAdjusted[K_NUMBER_OF_PAGES];
-    U8* mmuWritePtrAdjusted[K_NUMBER_OF_PAGES];
+    // these are back to back in pageTables, the translated code finds all of them from mmuReadPtrAdjusted
+    U8** mmuReadPtrAdjusted;
+    U8** mmuWritePtrAdjusted;
 #ifdef BOXEDWINE_4K_PAGE_SIZE
-    U8* mmuReadPtr[K_NUMBER_OF_PAGES];
-    U8* mmuWritePtr[K_NUMBER_OF_PAGES];
+    U8** mmuReadPtr;
+    U8** mmuWritePtr;
 #endif
 #endif  
 
@@ -70,6 +82,11 @@ public:
 #endif
 
     CodeCache codeCache;
+
+private:
+    bool usedRegions[K_MMU_REGION_COUNT];
+    U8* pageTables;
+    U32 pageTablesBlockCount; // 64k blocks
 };
 
 KMemoryData* getMemData(KMemory* memory);
@@ -26,7 +26,7 @@
 
 void CodePage::onDemmand(MMU* mmu, U32 pageIndex) {
     KThread* thread = KThread::currentThread();
-    if (!thread->memory->mapShared(pageIndex) && ramPageUseCount((RamPage)mmu->ramIndex) > 1) {
+    if (ramPageIsNative((RamPage)mmu->ramIndex) || (!thread->memory->mapShared(pageIndex) && ramPageUseCount((RamPage)mmu->ramIndex) > 1)) {
         RamPage ram = ramPageAlloc();
         ::memcpy(ramPageGet(ram), ramPageGet((RamPage)mmu->ramIndex), K_PAGE_SIZE);
         mmu->setPage(getMemData(thread->memory), pageIndex, PageType::Code, ram);
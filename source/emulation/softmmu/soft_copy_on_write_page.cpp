@@ -61,7 +61,8 @@ void CopyOnWritePage::onDemmand(MMU* mmu, U32 pageIndex) {
         return;
     }
 
-    if (!memory->mapShared(pageIndex) && ramPageUseCount((RamPage)mmu->ramIndex) > 1) {
+    // native pages are read only host mappings of a file, so they always need to be copied
+    if (ramPageIsNative((RamPage)mmu->ramIndex) || (!memory->mapShared(pageIndex) && ramPageUseCount((RamPage)mmu->ramIndex) > 1)) {
         RamPage ramIndex = ramPageAlloc();
         RamPage currentRamPage = mmu->getRamPageIndex();
 
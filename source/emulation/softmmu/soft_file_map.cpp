@@ -69,40 +69,156 @@ U8* FilePage::getRamPtr(MMU* mmu, U32 page, bool write, bool force, U32 offset,
     return Page::getRWPage()->getRamPtr(mmu, page, write, force, offset, len);
 }
 
+std::atomic<U32> FilePage::faultCount;
+std::atomic<U32> FilePage::faultAroundPageCount;
+std::atomic<U32> FilePage::nativePageCount;
+std::atomic<U32> FilePage::storedPageCount;
+
+BString FilePage::getStats() {
+    BString result = B("file faults ");
+    result.append(faultCount.load());
+    result.append(" saved ");
+    result.append(faultAroundPageCount.load());
+    result.append(" native ");
+    result.append(nativePageCount.load());
+    result.append(" stored ");
+    result.append(storedPageCount.load());
+    return result;
+}
+
 void FilePage::onDemmand(MMU* mmu, U32 pageIndex) {
     KThread* thread = KThread::currentThread();
     BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(thread->memory->mutex);
     if (mmu->getPageType() != PageType::File) {
         return;
     }
-    MappedFilePtr mappedFile = thread->process->getMappedFile(mmu->ramIndex);
+    KMemoryData* mem = getMemData(thread->memory);
+    U32 key = mmu->ramIndex;
+    MappedFilePtr mappedFile = thread->process->getMappedFile(key);
     U32 address = pageIndex << K_PAGE_SHIFT;
     U32 mappedOffset = (address - mappedFile->address) & 0xfffff000;
     U64 fileOffset = mappedOffset + mappedFile->offset;
     U32 fileOffsetPage = (U32)(fileOffset >> K_PAGE_SHIFT);
-    RamPage ramPage;
 
-    PageType pageType = PageType::Ram;
+    // start small and double the window each time the faults walk through the file in order
+    U32 window = KSystem::faultAroundPages ? KSystem::faultAroundPages : 1;
+    if (fileOffset == mappedFile->nextFaultOffset && mappedFile->faultAroundPages) {
+        window = std::min(window, mappedFile->faultAroundPages * 2);
+    } else {
+        window = std::min(window, 4u);
+    }
+    window = std::min(window, (U32)MAX_FAULT_AROUND_PAGES);
+    mappedFile->faultAroundPages = window;
 
-    if (mappedFile->systemCacheEntry && fileOffsetPage < (U32)mappedFile->systemCacheEntry->data.size()) {
-        ramPage = mappedFile->systemCacheEntry->data[fileOffsetPage];
-        if (ramPage.value) {
-            ramPageRetain(ramPage);
-            pageType = PageType::CopyOnWrite;
+    U32 pageCount = 1;
+    U64 fileLen = (U64)mappedFile->file->length();
+    if (window > 1) {
+        while (pageCount < window && pageIndex + pageCount < K_NUMBER_OF_PAGES) {
+            MMU& next = mem->mmu[pageIndex + pageCount];
+            if (next.getPageType() != PageType::File || next.ramIndex != key || fileOffset + ((U64)pageCount << K_PAGE_SHIFT) >= fileLen) {
+                break;
+            }
+            pageCount++;
         }
     }
+    mappedFile->nextFaultOffset = fileOffset + ((U64)pageCount << K_PAGE_SHIFT);
+    faultCount++;
+    faultAroundPageCount += pageCount - 1;
 
-    if (!ramPage.value) {
-        ramPage = ramPageAlloc();
-        mappedFile->file->preadNative(ramPageGet(ramPage), fileOffset, K_PAGE_SIZE);
-        if (mappedFile->systemCacheEntry && fileOffsetPage < (U32)mappedFile->systemCacheEntry->data.size()) {
-            ramPageRetain(ramPage);
-            ramPageMarkSystem(ramPage, true);
-            mappedFile->systemCacheEntry->data[fileOffsetPage] = ramPage;
+    std::shared_ptr<MappedFileCache> cache = mappedFile->systemCacheEntry;
+    RamPage ramPages[MAX_FAULT_AROUND_PAGES];
+    bool allocated[MAX_FAULT_AROUND_PAGES];
+    bool native[MAX_FAULT_AROUND_PAGES];
+    U32 readFirst = pageCount;
+    U32 readLast = 0;
+
+    for (U32 i = 0; i < pageCount; i++) {
+        ramPages[i].value = 0;
+        allocated[i] = false;
+        native[i] = false;
+        if (cache && fileOffsetPage + i < (U32)cache->data.size()) {
+            ramPages[i] = cache->data[fileOffsetPage + i];
+            // private mappings can share the host's page cache, the page is copied on the first write.  Shared mappings still go
+            // through cache->data so that writes are seen by other processes
+            if (!ramPages[i].value && !(mem->mmu[pageIndex + i].flags & PAGE_SHARED) && fileOffset + ((U64)i << K_PAGE_SHIFT) < fileLen) {
+                U8* nativePage = cache->getNativePage(fileOffsetPage + i);
+                if (nativePage) {
+                    ramPages[i] = ramPageAllocNative(nativePage);
+                    allocated[i] = true;
+                    native[i] = true;
+                    nativePageCount++;
+                }
+            }
+            if (!ramPages[i].value && cache->isPageStored(fileOffsetPage + i)) {
+                RamPage ramPage = ramPageAlloc();
+                if (cache->readStoredPage(fileOffsetPage + i, ramPageGet(ramPage))) {
+                    ramPages[i] = ramPage;
+                    allocated[i] = true;
+                    ramPageRetain(ramPage);
+                    ramPageMarkSystem(ramPage, true);
+                    cache->data[fileOffsetPage + i] = ramPage;
+                    storedPageCount++;
+                } else {
+                    ramPageRelease(ramPage);
+                }
+            }
+        }
+        if (!ramPages[i].value) {
+            readFirst = std::min(readFirst, i);
+            readLast = i;
+        }
+    }
+
+    // one read for all the pages that are not in the system cache
+    if (readFirst < pageCount) {
+        static thread_local std::vector<U8> buffer;
+        U32 len = (readLast - readFirst + 1) << K_PAGE_SHIFT;
+        buffer.resize(len);
+        U32 read = mappedFile->file->preadNative(buffer.data(), fileOffset + ((U64)readFirst << K_PAGE_SHIFT), len);
+        if ((S32)read < 0) {
+            read = 0;
+        }
+        if (read < len) {
+            memset(buffer.data() + read, 0, len - read);
+        }
+        if (cache) {
+            // only pages that were read in full are stored, a short read in the middle of the file would leave zeros in the store
+            // for good.  The last page of the file is complete once the read reaches the end of the file.
+            U32 completePages = read >> K_PAGE_SHIFT;
+            if ((read & K_PAGE_MASK) && fileOffset + ((U64)readFirst << K_PAGE_SHIFT) + read >= fileLen) {
+                completePages++;
+            }
+            if (completePages) {
+                cache->storePages(fileOffsetPage + readFirst, completePages, buffer.data());
+            }
+        }
+        for (U32 i = readFirst; i <= readLast; i++) {
+            if (ramPages[i].value) {
+                continue;
+            }
+            ramPages[i] = ramPageAlloc();
+            allocated[i] = true;
+            memcpy(ramPageGet(ramPages[i]), buffer.data() + ((i - readFirst) << K_PAGE_SHIFT), K_PAGE_SIZE);
+            if (cache && fileOffsetPage + i < (U32)cache->data.size()) {
+                ramPageRetain(ramPages[i]);
+                ramPageMarkSystem(ramPages[i], true);
+                cache->data[fileOffsetPage + i] = ramPages[i];
+            }
+        }
+    }
+
+    for (U32 i = 0; i < pageCount; i++) {
+        RamPage ramPage = ramPages[i];
+        PageType pageType = PageType::Ram;
+
+        if (native[i] || (cache && fileOffsetPage + i < (U32)cache->data.size())) {
             pageType = PageType::CopyOnWrite;
         }
+        if (!allocated[i]) {
+            ramPageRetain(ramPage);
+        }
+        mem->mmu[pageIndex + i].setPage(mem, pageIndex + i, pageType, ramPage);
+        ramPageRelease(ramPage); // setPageType retained ramPage
+        mem->onPageChanged(pageIndex + i);
     }
-    mmu->setPage(getMemData(thread->memory), pageIndex, pageType, ramPage);
-    ramPageRelease(ramPage); // setPageType retained ramPage
-    getMemData(thread->memory)->onPageChanged(pageIndex);
-}
\ No newline at end of file
+}
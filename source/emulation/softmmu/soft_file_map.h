@@ -21,6 +21,8 @@
 
 #include "soft_rw_page.h"
 
+#define MAX_FAULT_AROUND_PAGES 256
+
 class FilePage : public RWPage {
 public:
     // from Page
@@ -34,6 +36,12 @@ public:
     bool canWriteRam(MMU* mmu) override;
     U8* getRamPtr(MMU* mmu, U32 page, bool write = false, bool force = false, U32 offset = 0, U32 len = 0) override;
     void onDemmand(MMU* mmu, U32 pageIndex) override;
+
+    static std::atomic<U32> faultCount;
+    static std::atomic<U32> faultAroundPageCount; // pages mapped by a neighbor's fault, each one is a fault that won't happen
+    static std::atomic<U32> nativePageCount; // pages that use the host's mapping of the file instead of a copy
+    static std::atomic<U32> storedPageCount; // pages read from the persistent page store instead of the file
+    static BString getStats();
 };
 
 #endif
\ No newline at end of file
@@ -29,6 +29,11 @@ void MMU::setPageType(KMemoryData* mem, U32 page, PageType type) {
 }
 
 void MMU::setPage(KMemoryData* mem, U32 page, PageType type, RamPage ram) {
+#ifdef BOXEDWINE_BINARY_TRANSLATOR
+    if (ramIndex != ram.value || type == PageType::None) {
+        mem->codeChanged(page << K_PAGE_SHIFT, K_PAGE_SIZE);
+    }
+#endif
     if (getPageType() == PageType::Code && type != PageType::Code) {
         mem->codeCache.removeBlockAt(page << K_PAGE_SHIFT, K_PAGE_SIZE);
     }
@@ -43,6 +48,7 @@ void MMU::setPage(KMemoryData* mem, U32 page, PageType type, RamPage ram) {
         canWriteRam = 0;
         return;
     }
+    mem->setRegionUsed(page);
     // I have seen ramIndex == ram.value but it was moving from PageType::File to PageType::CopyOnWrite
     // so the ram index happen to equal the file key
     if (ramIndex != ram.value || type == PageType::File || getPageType() == PageType::File) {
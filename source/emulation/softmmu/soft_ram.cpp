@@ -222,9 +222,10 @@ void ramPageRelease(RamPage page) {
     BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(ramMutex);
     refCounts[page.value].refCount--;
     if (refCounts[page.value].refCount == 0) {
-        allocatedRamPages--;
         freeIndex(page.value);
-        if (refCounts[page.value].isNative) {
+        if (!refCounts[page.value].isNative) {
+            allocatedRamPages--;
+        } else {
             ramPages[page.value] = nullptr;
             refCounts[page.value].isNative = 0;
             refCounts[page.value].isSystem = 0;
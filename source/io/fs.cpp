@@ -35,15 +35,18 @@
 #include MKDIR_INCLUDE
 
 std::atomic_int Fs::nextNodeId=1;
+std::atomic<U32> Fs::pathGeneration;
 
 std::shared_ptr<FsFileNode> Fs::rootNode;
 BString Fs::nativePathSeperator;
 
 void Fs::shutDown() {
 	rootNode = nullptr;
+    Fs::pathsChanged();
 }
 bool Fs::initFileSystem(const BString& rootPath) {
     Fs::nextNodeId = 1;
+    Fs::pathsChanged();
     BString path;
     Fs::nativePathSeperator = (char)std::filesystem::path::preferred_separator;
     if (rootPath.endsWith("/")) {
@@ -128,8 +131,56 @@ std::shared_ptr<FsNode> Fs::addDynamicLinkFile(const BString& path, U32 rdev, co
     return result;
 }
 
+bool FsMissingPaths::contains(const BString& fullPath, bool followLink) {
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(this->mutex);
+    if (this->generation != Fs::pathGeneration) {
+        this->paths.clear();
+        this->generation = Fs::pathGeneration;
+        return false;
+    }
+    U32 flags = 0;
+    if (!this->paths.get(fullPath, flags)) {
+        return false;
+    }
+    return (flags & (followLink ? FS_MISSING_FOLLOW_LINK : FS_MISSING_NO_FOLLOW_LINK)) != 0;
+}
+
+void FsMissingPaths::add(const BString& fullPath, bool followLink, U32 generation) {
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(this->mutex);
+    if (generation != Fs::pathGeneration) {
+        return; // something changed while the path was being looked up
+    }
+    if (this->generation != generation || this->paths.size() >= FS_MAX_MISSING_PATHS) {
+        this->paths.clear();
+        this->generation = generation;
+    }
+    U32 flags = 0;
+    this->paths.get(fullPath, flags);
+    this->paths.set(fullPath, flags | (followLink ? FS_MISSING_FOLLOW_LINK : FS_MISSING_NO_FOLLOW_LINK));
+}
+
 std::shared_ptr<FsNode> Fs::getNodeFromLocalPath(const BString& currentDirectory, const BString& path, bool followLink, bool* isLink) {
-    return Fs::getNodeFromLocalPath(currentDirectory, path, nullptr, nullptr, followLink, isLink);
+    KThread* thread = KThread::currentThread();
+    if (!thread || !thread->process) {
+        return Fs::getNodeFromLocalPath(currentDirectory, path, nullptr, nullptr, followLink, isLink);
+    }
+    FsMissingPaths& missingPaths = thread->process->missingPaths;
+    BString fullPath = Fs::getFullPath(currentDirectory, path);
+    if (missingPaths.contains(fullPath, followLink)) {
+        return nullptr;
+    }
+    // read before the lookup so that a change during the lookup will prevent the miss from being cached
+    U32 generation = Fs::pathGeneration;
+    bool wasLink = false;
+    bool canCacheMiss = true;
+    std::shared_ptr<FsNode> result = Fs::getNodeFromLocalPath(B(""), fullPath, nullptr, nullptr, followLink, &wasLink, &canCacheMiss);
+    if (wasLink && isLink) {
+        *isLink = true;
+    }
+    if (!result && canCacheMiss && !wasLink) {
+        missingPaths.add(fullPath, followLink, generation);
+    }
+    return result;
 }
 
 BString Fs::getFullPath(const BString& currentDirectory, const BString& path) {
@@ -167,7 +218,7 @@ bool cleanPath(std::vector<BString>& parts) {
     return true;
 }
 
-std::shared_ptr<FsNode> Fs::getNodeFromLocalPath(const BString& currentDirectory, const BString& path, std::shared_ptr<FsNode>* lastNode, std::vector<BString>* missingParts, bool followLink, bool* isLink) {
+std::shared_ptr<FsNode> Fs::getNodeFromLocalPath(const BString& currentDirectory, const BString& path, std::shared_ptr<FsNode>* lastNode, std::vector<BString>* missingParts, bool followLink, bool* isLink, bool* canCacheMiss) {
     BString fullpath = Fs::getFullPath(currentDirectory, path);
 
     if (fullpath.length()==0 || fullpath=="/")
@@ -193,6 +244,10 @@ std::shared_ptr<FsNode> Fs::getNodeFromLocalPath(const BString& currentDirectory
             i++;
             continue;
         }
+        if (!node->hasPathLookups) {
+            // must be set before looking up the child so that a child added at the same time will invalidate a cached miss
+            node->hasPathLookups = true;
+        }
         node = node->getChildByName(parts[i]);
         if (!node) {
             if (missingParts) {
@@ -207,6 +262,10 @@ std::shared_ptr<FsNode> Fs::getNodeFromLocalPath(const BString& currentDirectory
         }
         nodes.push_back(node);
         if (node->isLink() && (followLink || i<parts.size()-1)) {
+            if (canCacheMiss && node->type == FsNode::Type::Virtual) {
+                // dynamic links, like /proc/self, can point somewhere else later without the tree changing
+                *canCacheMiss = false;
+            }
             if (i==parts.size()-1 && isLink) {
                 *isLink = true;
             }
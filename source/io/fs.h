@@ -67,6 +67,23 @@ class FsFileNode;
 
 #define k_mdev(x,y) ((x << 8) | y)
 
+#define FS_MISSING_FOLLOW_LINK 0x1
+#define FS_MISSING_NO_FOLLOW_LINK 0x2
+#define FS_MAX_MISSING_PATHS 4096
+
+// Paths that recently failed to resolve, Wine probes a lot of files that don't exist while resolving dll and dos paths
+// and this lets those probes skip walking the tree.  Everything is thrown away when Fs::pathsChanged is called.
+class FsMissingPaths {
+public:
+    bool contains(const BString& fullPath, bool followLink);
+    void add(const BString& fullPath, bool followLink, U32 generation);
+
+private:
+    BOXEDWINE_MUTEX mutex;
+    U32 generation = 0;
+    BHashTable<BString, U32> paths; // value is FS_MISSING_FOLLOW_LINK and/or FS_MISSING_NO_FOLLOW_LINK
+};
+
 class Fs {
 public:   
     static bool initFileSystem(const BString& rootPath);
@@ -110,10 +127,14 @@ public:
 
     static std::shared_ptr<FsFileNode> rootNode;
 	static void shutDown();
+
+    // called when a node is added to a directory that has been looked up, missing paths might exist now
+    static void pathsChanged() {Fs::pathGeneration++;}
+    static std::atomic<U32> pathGeneration;
 private:
     friend class KUnixSocketObject;
 
-    static std::shared_ptr<FsNode> getNodeFromLocalPath(const BString& currentDirectory, const BString& path, std::shared_ptr<FsNode>* lastNode, std::vector<BString>* missingParts, bool followLink, bool* isLink= nullptr);
+    static std::shared_ptr<FsNode> getNodeFromLocalPath(const BString& currentDirectory, const BString& path, std::shared_ptr<FsNode>* lastNode, std::vector<BString>* missingParts, bool followLink, bool* isLink= nullptr, bool* canCacheMiss = nullptr);
 
     static std::atomic_int nextNodeId;
 };
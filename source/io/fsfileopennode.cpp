@@ -21,6 +21,9 @@
 #include UNISTD
 #include <fcntl.h>
 #include "fsfilenode.h"
+#if defined(BOXEDWINE_POSIX) && defined(BOXEDWINE_64)
+#include <sys/mman.h>
+#endif
 
 FsFileOpenNode::FsFileOpenNode(const std::shared_ptr<FsFileNode>& node, U32 flags, U32 handle) : FsOpenNode(node, flags), fileNode(node), handle(handle) {
 }
@@ -109,6 +112,23 @@ bool FsFileOpenNode::canMap() {
     return true;
 }
 
+bool FsFileOpenNode::canMapNative() {
+#if defined(BOXEDWINE_POSIX) && defined(BOXEDWINE_64)
+    // 32-bit hosts don't have the address space to spare
+    return (this->flags & K_O_ACCMODE) != K_O_WRONLY && sysconf(_SC_PAGESIZE) == K_PAGE_SIZE;
+#else
+    return false;
+#endif
+}
+
+bool FsFileOpenNode::mapNativePage(U8* address, U64 offset) {
+#if defined(BOXEDWINE_POSIX) && defined(BOXEDWINE_64)
+    return mmap(address, K_PAGE_SIZE, PROT_READ, MAP_PRIVATE | MAP_FIXED, this->handle, (off_t)offset) != MAP_FAILED;
+#else
+    return false;
+#endif
+}
+
 U32 FsFileOpenNode::readNative(U8* buffer, U32 len) {
     return (U32)::read(this->handle, buffer, len);
 }
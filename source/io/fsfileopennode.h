@@ -46,6 +46,8 @@ public:
     void close() override;
     void reopen() override;
     bool isOpen() override;
+    bool canMapNative() override;
+    bool mapNativePage(U8* address, U64 offset) override;
 
 private:
     std::shared_ptr<FsFileNode> fileNode;
@@ -29,9 +29,11 @@ FsNode::FsNode(Type type, U32 id, U32 rdev, BString path, BString link, BString
     rdev(rdev),
     hardLinkCount(1),
     type(type),  
+    hasPathLookups(false),
     parent(parent),
     isDir(isDirectory),      
     hasLoadedChildrenFromFileSystem(false),
+    childCaseCollisions(0),
     locksCS(std::make_shared<BoxedWineCondition>(B("FsNode.lockCS")))
  {   
 }
@@ -53,7 +55,30 @@ void FsNode::removeNodeFromParent() {
     std::shared_ptr<FsNode> parent = this->getParent().lock();
     if (parent) {
         BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(parent->childrenByNameMutex);
-        parent->childrenByName.remove(this->name);
+        parent->internalRemoveChild(this->name);
+    }
+}
+
+// childrenByNameMutex must be held
+void FsNode::internalRemoveChild(const BString& name) {
+    std::shared_ptr<FsNode> child = this->childrenByName.get(name);
+    if (!child) {
+        return;
+    }
+    this->childrenByName.remove(name);
+
+    BString lowerName = name.toLowerCase();
+    if (this->childrenByLowerName.get(lowerName) == child) {
+        this->childrenByLowerName.remove(lowerName);
+        if (this->childCaseCollisions) {
+            // another child might only differ by case, it now needs to be found by the lower case index
+            for (auto& n : this->childrenByName) {
+                if (n.key.compareTo(name, true) == 0) {
+                    this->childrenByLowerName.set(lowerName, n.value);
+                    break;
+                }
+            }
+        }
     }
 }
 
@@ -108,12 +133,7 @@ std::shared_ptr<FsNode> FsNode::getChildByName(BString name) {
 std::shared_ptr<FsNode> FsNode::getChildByNameIgnoreCase(BString name) {
     this->loadChildren();
     BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(this->childrenByNameMutex);
-    for (auto& n : this->childrenByName) {
-        if (n.key.compareTo(name, true) == 0) {
-            return n.value;
-        }
-    }
-    return nullptr;
+    return this->childrenByLowerName.get(name.toLowerCase());
 }
 
 U32 FsNode::getChildCount() {    
@@ -124,14 +144,28 @@ U32 FsNode::getChildCount() {
 
 void FsNode::addChild(std::shared_ptr<FsNode> node) {
     this->loadChildren();
-    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(this->childrenByNameMutex);
-    this->childrenByName.set(node->name, node);
+    {
+        BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(this->childrenByNameMutex);
+        this->childrenByName.set(node->name, node);
+
+        BString lowerName = node->name.toLowerCase();
+        std::shared_ptr<FsNode> existing = this->childrenByLowerName.get(lowerName);
+        if (!existing || existing->name == node->name) {
+            this->childrenByLowerName.set(lowerName, node);
+        } else {
+            this->childCaseCollisions++;
+        }
+    }
+    // a path that used to be missing might resolve now
+    if (this->hasPathLookups) {
+        Fs::pathsChanged();
+    }
 }
 
 void FsNode::removeChildByName(BString name) {
     this->loadChildren();
     BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(this->childrenByNameMutex);
-    this->childrenByName.remove(name);
+    this->internalRemoveChild(name);
 }
 
 void FsNode::getAllChildren(std::vector<std::shared_ptr<FsNode> > & results) {
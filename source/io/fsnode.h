@@ -95,6 +95,9 @@ public:
     void unlockAll(U32 pid);
 
     void addOpenNode(KListNode<FsOpenNode*>* node);
+
+    // set once a path lookup has walked through this node, after that adding a child will invalidate the missing path caches
+    std::atomic_bool hasPathLookups;
 protected:
     std::weak_ptr<FsNode> parent; // the parent holds a strong reference to the children
 
@@ -106,12 +109,15 @@ private:
     bool hasLoadedChildrenFromFileSystem;    
 
     BHashTable<BString, std::shared_ptr<FsNode> > childrenByName;
+    BHashTable<BString, std::shared_ptr<FsNode> > childrenByLowerName; // key is the lower case name, only one node per key if names differ by case
+    U32 childCaseCollisions; // number of times a child was added that only differed by case from an existing child
     BOXEDWINE_MUTEX childrenByNameMutex;
 
     std::vector<KFileLock> locks;       
     BOXEDWINE_CONDITION locksCS;    
 
     void loadChildren();
+    void internalRemoveChild(const BString& name);
     KFileLock* internalGetLock(KFileLock* lock, bool otherProcess);
 };
 
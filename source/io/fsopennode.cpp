@@ -42,14 +42,7 @@ U32 FsOpenNode::internalRead(KThread* thread, U32 address, U32 len) {
 }
 
 U32 FsOpenNode::read(KThread* thread, U32 address, U32 len) {
-    BOXEDWINE_MUTEX* mutex = getReadMutex();
-    if (mutex) {
-        // this will reduce thashing in the zip file
-        BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(*mutex);
-        return internalRead(thread, address, len);
-    } else {
-        return internalRead(thread, address, len);
-    }
+    return internalRead(thread, address, len);
 }
 
 U32 FsOpenNode::write(KThread* thread, U32 address, U32 len) {
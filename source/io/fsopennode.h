@@ -26,7 +26,7 @@ class FsOpenNode {
 public:
     FsOpenNode(std::shared_ptr<FsNode> node, U32 flags);
 
-    U32 read(KThread* thread, U32 address, U32 len); // will call into readNative
+    virtual U32 read(KThread* thread, U32 address, U32 len); // will call into readNative
     U32 write(KThread* thread, U32 address, U32 len); // will call into writeNative
 
     U32 getDirectoryEntryCount();
@@ -51,7 +51,9 @@ public:
     virtual void close()=0;
     virtual void reopen()=0;
     virtual bool isOpen()=0;
-    virtual BOXEDWINE_MUTEX* getReadMutex() {return nullptr;}
+    // lets read only file mappings use the host's page cache directly instead of copying the file into emulated ram
+    virtual bool canMapNative() {return false;}
+    virtual bool mapNativePage(U8* address, U64 offset) {return false;} // address is already reserved, the page is mapped read only over it
 
     std::shared_ptr<FsNode> const node;
     const U32 flags;     
@@ -29,25 +29,356 @@ extern "C"
 #include "fszipnode.h"
 #include <time.h> 
 
-void FsZip::setupZipRead(U64 zipOffset, U64 zipFileOffset) {
-#ifdef BOXEDWINE_ZLIB    
-    if (zipOffset != lastZipOffset || zipFileOffset < lastZipFileOffset) {
-        unzCloseCurrentFile(this->zipfile);
-        unzSetOffset64(this->zipfile, zipOffset);
-        lastZipFileOffset = 0;
-        unzOpenCurrentFile(this->zipfile);
-        lastZipOffset = zipOffset;
-    }
-    if (zipFileOffset != lastZipFileOffset) {
-        char tmp[4096] = {};
-        U32 todo = (U32)(zipFileOffset - lastZipFileOffset);
-        while (todo) {
-            todo-=unzReadCurrentFile(this->zipfile, tmp, todo>4096?4096:todo);
+FsZipEntry::~FsZipEntry() {
+    if (checkpointCache) {
+        checkpointCache->removeEntry(this);
+    }
+}
+
+static std::vector<std::shared_ptr<FsZipCheckpoint>>::iterator firstCheckpointAfter(std::vector<std::shared_ptr<FsZipCheckpoint>>& checkpoints, U64 pos) {
+    return std::upper_bound(checkpoints.begin(), checkpoints.end(), pos, [](U64 pos, const std::shared_ptr<FsZipCheckpoint>& checkpoint) {
+        return pos < checkpoint->out;
+        });
+}
+
+std::shared_ptr<FsZipCheckpoint> FsZipCheckpoints::find(FsZipEntry* entry, U64 pos) {
+    FsZipLock lock(mutex);
+    auto it = firstCheckpointAfter(entry->checkpoints, pos);
+    if (it == entry->checkpoints.begin()) {
+        return nullptr;
+    }
+    std::shared_ptr<FsZipCheckpoint> result = *(it - 1);
+    lru.splice(lru.begin(), lru, result->lruIt);
+    return result;
+}
+
+bool FsZipCheckpoints::wantsLocked(FsZipEntry* entry, U64 out) {
+    if (out < FS_ZIP_CHECKPOINT_SPAN) {
+        return false;
+    }
+    // an evicted checkpoint leaves a gap that a later read will fill in again
+    auto it = firstCheckpointAfter(entry->checkpoints, out);
+    if (it != entry->checkpoints.end() && (*it)->out - out < FS_ZIP_CHECKPOINT_SPAN) {
+        return false;
+    }
+    if (it != entry->checkpoints.begin() && out - (*(it - 1))->out < FS_ZIP_CHECKPOINT_SPAN) {
+        return false;
+    }
+    return true;
+}
+
+bool FsZipCheckpoints::wants(FsZipEntry* entry, U64 out) {
+    FsZipLock lock(mutex);
+    return wantsLocked(entry, out);
+}
+
+void FsZipCheckpoints::add(FsZipEntry* entry, const std::shared_ptr<FsZipCheckpoint>& checkpoint) {
+    FsZipLock lock(mutex);
+    // another reader of the same entry might have got there first
+    if (!wantsLocked(entry, checkpoint->out)) {
+        return;
+    }
+    entry->checkpoints.insert(firstCheckpointAfter(entry->checkpoints, checkpoint->out), checkpoint);
+    lru.push_front({ entry, checkpoint.get() });
+    checkpoint->lruIt = lru.begin();
+
+    while (lru.size() > FS_ZIP_MAX_CHECKPOINTS) {
+        FsZipCheckpointUse& use = lru.back();
+        std::vector<std::shared_ptr<FsZipCheckpoint>>& checkpoints = use.entry->checkpoints;
+        checkpoints.erase(std::find_if(checkpoints.begin(), checkpoints.end(), [&use](const std::shared_ptr<FsZipCheckpoint>& c) {
+            return c.get() == use.checkpoint;
+            }));
+        lru.pop_back();
+    }
+}
+
+void FsZipCheckpoints::removeEntry(FsZipEntry* entry) {
+    FsZipLock lock(mutex);
+    for (auto& checkpoint : entry->checkpoints) {
+        lru.erase(checkpoint->lruIt);
+    }
+    entry->checkpoints.clear();
+}
+
+FsZipReader::FsZipReader(BString zipPath) : file(zipPath) {
+    strmValid = inflateInit2(&strm, -MAX_WBITS) == Z_OK;
+}
+
+FsZipReader::~FsZipReader() {
+    if (strmValid) {
+        inflateEnd(&strm);
+    }
+}
+
+bool FsZipReader::restart(const std::shared_ptr<FsZipEntry>& entry, const std::shared_ptr<FsZipCheckpoint>& checkpoint) {
+    this->entry = nullptr;
+    if (!strmValid || inflateReset(&strm) != Z_OK) {
+        return false;
+    }
+    strm.next_in = input;
+    strm.avail_in = 0;
+    strm.next_out = window;
+    strm.avail_out = 0;
+    if (checkpoint) {
+        if (checkpoint->bits) {
+            U8 value = 0;
+
+            file.setPos(checkpoint->in - 1);
+            if (!file.read(value)) {
+                return false;
+            }
+            inflatePrime(&strm, checkpoint->bits, value >> (8 - checkpoint->bits));
+        }
+        inflateSetDictionary(&strm, checkpoint->window, FS_ZIP_WINDOW_SIZE);
+        inPos = checkpoint->in;
+        outPos = checkpoint->out;
+    } else {
+        inPos = entry->dataOffset;
+        outPos = 0;
+    }
+    restartPos = outPos;
+    this->entry = entry;
+    return true;
+}
+
+bool FsZipReader::fillInput() {
+    U64 end = entry->dataOffset + entry->compressedSize;
+    if (inPos >= end) {
+        return false;
+    }
+    U32 todo = (U32)std::min<U64>(sizeof(input), end - inPos);
+    file.setPos(inPos);
+    U32 read = file.read(input, todo);
+    strm.next_in = input;
+    strm.avail_in = read;
+    inPos += read;
+    return read != 0;
+}
+
+void FsZipReader::saveCheckpoint() {
+    std::shared_ptr<FsZipCheckpoint> checkpoint = std::make_shared<FsZipCheckpoint>();
+    checkpoint->out = outPos;
+    checkpoint->in = inPos - strm.avail_in;
+    checkpoint->bits = strm.data_type & 7;
+
+    // window is circular, the oldest byte is where the next output byte would go
+    U32 newest = (U32)(strm.next_out - window);
+    memcpy(checkpoint->window, window + newest, FS_ZIP_WINDOW_SIZE - newest);
+    memcpy(checkpoint->window + FS_ZIP_WINDOW_SIZE - newest, window, newest);
+    entry->addCheckpoint(checkpoint);
+}
+
+U32 FsZipReader::read(const std::shared_ptr<FsZipEntry>& entry, U64 pos, U8* buffer, U32 len) {
+    if (!file.isOpen() || pos >= entry->uncompressedSize) {
+        return 0;
+    }
+    if (len > entry->uncompressedSize - pos) {
+        len = (U32)(entry->uncompressedSize - pos);
+    }
+    if (entry->method == 0) {
+        file.setPos(entry->dataOffset + pos);
+        return file.read(buffer, len);
+    }
+    if (entry->method != Z_DEFLATED) {
+        klog_fmt("FsZipReader::read unsupported compression method %d", entry->method);
+        return 0;
+    }
+    std::shared_ptr<FsZipCheckpoint> checkpoint = entry->findCheckpoint(pos);
+    if (this->entry != entry || pos < outPos || (checkpoint && checkpoint->out > outPos)) {
+        if (!restart(entry, checkpoint)) {
+            return 0;
+        }
+    }
+
+    U64 end = pos + len;
+    U32 result = 0;
+
+    while (outPos < end) {
+        if (!strm.avail_in && !fillInput()) {
+            break;
+        }
+        if (strm.next_out == window + FS_ZIP_WINDOW_SIZE) {
+            strm.next_out = window;
+        }
+        // never inflate past what was asked for, that way a sequential read can continue from here
+        strm.avail_out = (uInt)std::min<U64>(window + FS_ZIP_WINDOW_SIZE - strm.next_out, end - outPos);
+
+        U8* start = strm.next_out;
+        int ret = inflate(&strm, Z_BLOCK);
+        if (ret == Z_NEED_DICT || ret == Z_DATA_ERROR || ret == Z_MEM_ERROR || ret == Z_STREAM_ERROR) {
+            klog_fmt("FsZipReader::read inflate failed %d", ret);
+            this->entry = nullptr;
+            break;
+        }
+        U32 produced = (U32)(strm.next_out - start);
+        if (ret == Z_BUF_ERROR && !produced && strm.avail_in) {
+            break;
+        }
+        if (outPos + produced > pos) {
+            U32 skip = (U32)(pos > outPos ? pos - outPos : 0);
+            memcpy(buffer + result, start + skip, produced - skip);
+            result += produced - skip;
+        }
+        outPos += produced;
+        if (ret == Z_STREAM_END) {
+            break;
+        }
+        // bit 7 means the end of a deflate block header, bit 6 the last block
+        if ((strm.data_type & 128) && !(strm.data_type & 64) && outPos - restartPos >= FS_ZIP_WINDOW_SIZE && entry->wantsCheckpoint(outPos)) {
+            saveCheckpoint();
         }
-    }  
+    }
+    return result;
+}
+
+std::shared_ptr<FsZipEntry> FsZip::getEntry(U64 zipOffset) {
+    FsZipLock lock(entriesMutex);
+    std::shared_ptr<FsZipEntry> result = entries.get(zipOffset);
+    if (result) {
+        return result;
+    }
+    unz_file_info64 fileInfo = {};
+    if (unzSetOffset64(zipfile, zipOffset) != UNZ_OK || unzGetCurrentFileInfo64(zipfile, &fileInfo, nullptr, 0, nullptr, 0, nullptr, 0) != UNZ_OK) {
+        return nullptr;
+    }
+    if (unzOpenCurrentFile(zipfile) != UNZ_OK) {
+        return nullptr;
+    }
+    result = std::make_shared<FsZipEntry>();
+    result->checkpointCache = checkpoints;
+    result->dataOffset = unzGetCurrentFileZStreamPos64(zipfile);
+    result->compressedSize = fileInfo.compressed_size;
+    result->uncompressedSize = fileInfo.uncompressed_size;
+    result->method = (U32)fileInfo.compression_method;
+    unzCloseCurrentFile(zipfile);
+    entries.set(zipOffset, result);
+    return result;
+}
+
+BOXEDWINE_MUTEX FsZipBlockCache::mutex;
+std::list<FsZipBlockCache::Entry> FsZipBlockCache::lru;
+BHashTable<FsZipCacheKey, FsZipBlockCache::Slot, FsZipCacheKeyHash> FsZipBlockCache::blocks;
+U64 FsZipBlockCache::size;
+std::atomic<U32> FsZipBlockCache::hits;
+std::atomic<U32> FsZipBlockCache::misses;
+std::atomic<U32> FsZipBlockCache::evictions;
+
+FsZipCacheBlock FsZipBlockCache::get(const FsZipCacheKey& key) {
+    FsZipLock lock(mutex);
+    Slot slot;
+    if (!blocks.get(key, slot)) {
+        misses++;
+        return nullptr;
+    }
+    hits++;
+    lru.splice(lru.begin(), lru, slot.it);
+    return slot.it->block;
+}
+
+void FsZipBlockCache::put(const FsZipCacheKey& key, const FsZipCacheBlock& block) {
+    U64 budget = (U64)KSystem::zipCacheMB * 1024 * 1024;
+    if (block->size() > budget) {
+        return;
+    }
+    FsZipLock lock(mutex);
+    Slot slot;
+    if (blocks.get(key, slot)) {
+        // another thread inflated the same block at the same time
+        lru.splice(lru.begin(), lru, slot.it);
+        return;
+    }
+    trim(budget - block->size());
+    lru.push_front({key, block});
+    slot.it = lru.begin();
+    blocks.set(key, slot);
+    size += block->size();
+}
+
+void FsZipBlockCache::trim(U64 budget) {
+    while (size > budget && lru.size()) {
+        Entry& entry = lru.back();
+        size -= entry.block->size();
+        blocks.remove(entry.key);
+        lru.pop_back();
+        evictions++;
+    }
+}
+
+void FsZipBlockCache::remove(const FsZip* zip) {
+    FsZipLock lock(mutex);
+    for (auto it = lru.begin(); it != lru.end();) {
+        if (it->key.zip == zip) {
+            size -= it->block->size();
+            blocks.remove(it->key);
+            it = lru.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+U64 FsZipBlockCache::getSize() {
+    FsZipLock lock(mutex);
+    return size;
+}
+
+std::atomic<U64> FsZip::lockWaitMicroSeconds;
+std::atomic<U32> FsZip::lockWaitCount;
+
+FsZipLock::FsZipLock(BOXEDWINE_MUTEX& mutex)
+#ifdef BOXEDWINE_MULTI_THREADED
+    : lock(mutex, std::try_to_lock) {
+    if (!lock.owns_lock()) {
+        U64 start = KSystem::getMicroCounter();
+        lock.lock();
+        FsZip::lockWaitMicroSeconds += KSystem::getMicroCounter() - start;
+        FsZip::lockWaitCount++;
+    }
+#else
+    {
 #endif
 }
 
+std::shared_ptr<FsZipReader> FsZip::leaseReader(const std::shared_ptr<FsZipEntry>& entry, U64 pos) {
+    FsZipLock lock(readersMutex);
+    if (idleReaders.size()) {
+        U32 index = (U32)idleReaders.size() - 1;
+        for (U32 i = 0; i < (U32)idleReaders.size(); i++) {
+            if (idleReaders[i]->canContinue(entry, pos)) {
+                index = i;
+                break;
+            }
+        }
+        std::shared_ptr<FsZipReader> result = idleReaders[index];
+        idleReaders.erase(idleReaders.begin() + index);
+        return result;
+    }
+    return std::make_shared<FsZipReader>(zipPath);
+}
+
+void FsZip::releaseReader(const std::shared_ptr<FsZipReader>& reader) {
+    FsZipLock lock(readersMutex);
+    if (idleReaders.size() < FS_ZIP_MAX_IDLE_READERS) {
+        idleReaders.push_back(reader);
+    }
+}
+
+BString FsZip::getStats() {
+    BString result = B("zip lock waits ");
+    result.append(lockWaitCount.load());
+    result.append(" (");
+    result.append(lockWaitMicroSeconds.load() / 1000);
+    result.append("ms) zip cache ");
+    result.append(FsZipBlockCache::getSize() / 1024 / 1024);
+    result.append("MB hits ");
+    result.append(FsZipBlockCache::hits.load());
+    result.append(" misses ");
+    result.append(FsZipBlockCache::misses.load());
+    result.append(" evictions ");
+    result.append(FsZipBlockCache::evictions.load());
+    return result;
+}
+
 bool FsZip::init(BString zipPath, BString mount) {
 #ifdef BOXEDWINE_ZLIB
     BString strippedMount;
@@ -58,7 +389,7 @@ bool FsZip::init(BString zipPath, BString mount) {
         Fs::makeLocalDirs(mount);
         strippedMount = mount.substr(0, mount.length() - 1);
     }
-    this->lastZipOffset = 0xFFFFFFFFFFFFFFFFl;
+    this->zipPath = zipPath;
     if (zipPath.length()) {
         unz_global_info global_info = {};
 
@@ -151,6 +482,7 @@ bool FsZip::init(BString zipPath, BString mount) {
 
 FsZip::~FsZip() {
 #ifdef BOXEDWINE_ZLIB
+    FsZipBlockCache::remove(this);
     unzClose(this->zipfile);
 #endif
 }
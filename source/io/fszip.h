@@ -43,6 +43,164 @@ public:
     U64 offset = 0;
 };
 
+// Every FS_ZIP_CHECKPOINT_SPAN bytes of uncompressed output the inflate state is saved so that
+// a later read at a random offset only needs to inflate from the nearest checkpoint instead of
+// from the start of the entry.  Each checkpoint holds a whole window, so an FsZip keeps at most
+// FS_ZIP_MAX_CHECKPOINTS of them across all of its entries and drops the least recently used.
+#define FS_ZIP_CHECKPOINT_SPAN (128*1024)
+#define FS_ZIP_WINDOW_SIZE 32768
+#define FS_ZIP_MAX_CHECKPOINTS 512
+
+class FsZipEntry;
+class FsZipCheckpoint;
+
+class FsZipCheckpointUse {
+public:
+    FsZipEntry* entry;
+    FsZipCheckpoint* checkpoint;
+};
+
+class FsZipCheckpoint {
+public:
+    U64 out = 0; // offset in the uncompressed entry
+    U64 in = 0; // offset in the zip file of the first compressed byte that has not been consumed
+    U32 bits = 0; // number of bits from the byte before "in" that have not been consumed
+    U8 window[FS_ZIP_WINDOW_SIZE] = {};
+
+    std::list<FsZipCheckpointUse>::iterator lruIt;
+};
+
+// the checkpoints of every entry of one FsZip
+class FsZipCheckpoints {
+public:
+    std::shared_ptr<FsZipCheckpoint> find(FsZipEntry* entry, U64 pos);
+    bool wants(FsZipEntry* entry, U64 out);
+    void add(FsZipEntry* entry, const std::shared_ptr<FsZipCheckpoint>& checkpoint);
+    void removeEntry(FsZipEntry* entry);
+
+private:
+    bool wantsLocked(FsZipEntry* entry, U64 out);
+
+    BOXEDWINE_MUTEX mutex;
+    std::list<FsZipCheckpointUse> lru; // most recently used first
+};
+
+class FsZipEntry {
+public:
+    ~FsZipEntry();
+
+    U64 dataOffset = 0; // offset in the zip file of the compressed data
+    U64 compressedSize = 0;
+    U64 uncompressedSize = 0;
+    U32 method = 0;
+
+    std::shared_ptr<FsZipCheckpoint> findCheckpoint(U64 pos) { return checkpointCache->find(this, pos); }
+    void addCheckpoint(const std::shared_ptr<FsZipCheckpoint>& checkpoint) { checkpointCache->add(this, checkpoint); }
+    // true if there is no checkpoint within FS_ZIP_CHECKPOINT_SPAN of out
+    bool wantsCheckpoint(U64 out) { return checkpointCache->wants(this, out); }
+
+    std::shared_ptr<FsZipCheckpoints> checkpointCache;
+
+private:
+    friend class FsZipCheckpoints;
+    std::vector<std::shared_ptr<FsZipCheckpoint>> checkpoints; // sorted by out, guarded by checkpointCache
+};
+
+// raw deflate cursor over the zip file, it does not go through minizip so that it can resume
+// inflating from any checkpoint
+class FsZipReader {
+public:
+    FsZipReader(BString zipPath);
+    ~FsZipReader();
+
+    U32 read(const std::shared_ptr<FsZipEntry>& entry, U64 pos, U8* buffer, U32 len);
+    // true if a read at pos can keep inflating from where this reader stopped
+    bool canContinue(const std::shared_ptr<FsZipEntry>& entry, U64 pos) const { return this->entry == entry && pos >= outPos && pos - outPos < FS_ZIP_CHECKPOINT_SPAN; }
+
+private:
+    bool restart(const std::shared_ptr<FsZipEntry>& entry, const std::shared_ptr<FsZipCheckpoint>& checkpoint);
+    bool fillInput();
+    void saveCheckpoint();
+
+    BReadFile file;
+    z_stream strm = {};
+    bool strmValid = false;
+    std::shared_ptr<FsZipEntry> entry;
+    U64 inPos = 0;
+    U64 outPos = 0;
+    U64 restartPos = 0; // window only holds real output once this is FS_ZIP_WINDOW_SIZE behind outPos
+    U8 input[16384] = {};
+    U8 window[FS_ZIP_WINDOW_SIZE] = {};
+};
+
+// decompressed blocks shared by every open node of every process, so a file opened by
+// several emulated processes is only inflated once.  KSystem::zipCacheMB is the budget.
+#define FS_ZIP_CACHE_BLOCK_SIZE (64*1024)
+
+class FsZip;
+
+class FsZipCacheKey {
+public:
+    const FsZip* zip = nullptr;
+    U64 entryOffset = 0;
+    U32 block = 0;
+
+    bool operator==(const FsZipCacheKey& other) const {
+        return zip == other.zip && entryOffset == other.entryOffset && block == other.block;
+    }
+};
+
+class FsZipCacheKeyHash {
+public:
+    std::size_t operator()(const FsZipCacheKey& key) const {
+        return std::hash<U64>()((U64)(uintptr_t)key.zip ^ (key.entryOffset << 16) ^ key.block);
+    }
+};
+
+typedef std::shared_ptr<std::vector<U8>> FsZipCacheBlock;
+
+class FsZipBlockCache {
+public:
+    static FsZipCacheBlock get(const FsZipCacheKey& key);
+    static void put(const FsZipCacheKey& key, const FsZipCacheBlock& block);
+    static void remove(const FsZip* zip);
+
+    static std::atomic<U32> hits;
+    static std::atomic<U32> misses;
+    static std::atomic<U32> evictions;
+    static U64 getSize();
+
+private:
+    class Entry {
+    public:
+        FsZipCacheKey key;
+        FsZipCacheBlock block;
+    };
+    class Slot {
+    public:
+        std::list<Entry>::iterator it;
+    };
+    static void trim(U64 budget);
+
+    static BOXEDWINE_MUTEX mutex;
+    static std::list<Entry> lru; // most recently used first
+    static BHashTable<FsZipCacheKey, Slot, FsZipCacheKeyHash> blocks;
+    static U64 size;
+};
+
+// locks one of the mutexes shared by every reader of an FsZip and records how long it had to wait in FsZip's stats
+class FsZipLock {
+public:
+    FsZipLock(BOXEDWINE_MUTEX& mutex);
+#ifdef BOXEDWINE_MULTI_THREADED
+private:
+    std::unique_lock<std::recursive_mutex> lock;
+#endif
+};
+
+// idle readers kept around for the next read, readers are only created on demand so this is not a limit on concurrent reads
+#define FS_ZIP_MAX_IDLE_READERS 8
+
 class FsZip : public std::enable_shared_from_this<FsZip> {
 public:
     FsZip() = default;
@@ -50,12 +208,16 @@ public:
     bool init(BString zipPath, BString mount);
     unzFile zipfile = nullptr;
 
-    U64 lastZipOffset = 0xFFFFFFFFFFFFFFFFl;
-    U64 lastZipFileOffset = 0;
+    std::shared_ptr<FsZipEntry> getEntry(U64 zipOffset);
 
-    BOXEDWINE_MUTEX readMutex;
+    // each read leases a reader so that different entries can be inflated in parallel without every open file holding
+    // a host file and inflate state, one that stopped just before pos in the same entry is preferred
+    std::shared_ptr<FsZipReader> leaseReader(const std::shared_ptr<FsZipEntry>& entry, U64 pos);
+    void releaseReader(const std::shared_ptr<FsZipReader>& reader);
 
-    void setupZipRead(U64 zipOffset, U64 zipFileOffset);
+    static std::atomic<U64> lockWaitMicroSeconds;
+    static std::atomic<U32> lockWaitCount;
+    static BString getStats();
     void remove(BString localPath);
 
     static bool readFileFromZip(BString zipFile, BString file, BString& result);
@@ -65,6 +227,14 @@ public:
     static bool doesFileExist(BString zipFile, BString file);
 private:
     BString deleteFilePath;
+    BString zipPath;
+
+    BOXEDWINE_MUTEX readersMutex;
+    std::vector<std::shared_ptr<FsZipReader>> idleReaders;
+
+    BOXEDWINE_MUTEX entriesMutex;
+    BHashTable<U64, std::shared_ptr<FsZipEntry>> entries;
+    std::shared_ptr<FsZipCheckpoints> checkpoints = std::make_shared<FsZipCheckpoints>();
 };
 #endif
 #endif
@@ -28,6 +28,16 @@
 FsZipOpenNode::FsZipOpenNode(std::shared_ptr<FsNode> node, std::shared_ptr<FsZipNode>& zipNode, U32 flags, U64 offset) : FsOpenNode(node, flags), zipNode(zipNode), pos(0), offset(offset) {
 }
 
+// gives the reader back to the FsZip pool when the read is done
+class FsZipReaderLease {
+public:
+    FsZipReaderLease(const std::shared_ptr<FsZip>& fsZip, const std::shared_ptr<FsZipEntry>& entry, U64 pos) : fsZip(fsZip), reader(fsZip->leaseReader(entry, pos)) {}
+    ~FsZipReaderLease() { fsZip->releaseReader(reader); }
+
+    const std::shared_ptr<FsZip>& fsZip;
+    std::shared_ptr<FsZipReader> reader;
+};
+
 S64 FsZipOpenNode::length() {
     return this->node->length();
 }
@@ -91,14 +101,46 @@ bool FsZipOpenNode::canMap() {
 }
 
 U32 FsZipOpenNode::readNative(U8* buffer, U32 len) {
-    U32 result = 0;
-    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(*getReadMutex());
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(readMutex);
     std::shared_ptr<FsZip> fsZip = zipNode->fsZip.lock();
-    if (fsZip) {
-        fsZip->setupZipRead(this->offset, this->pos);
-        result = unzReadCurrentFile(fsZip->zipfile, buffer, len);
+    if (!fsZip) {
+        return 0;
+    }
+    if (!entry) {
+        entry = fsZip->getEntry(this->offset);
+        if (!entry) {
+            return 0;
+        }
+    }
+    // stored entries are just a copy from the zip file, there is nothing to gain by caching them
+    if (entry->method == 0 || !KSystem::zipCacheMB) {
+        FsZipReaderLease lease(fsZip, entry, this->pos);
+        U32 result = lease.reader->read(entry, this->pos, buffer, len);
         this->pos += result;
-        fsZip->lastZipFileOffset = this->pos;
+        return result;
+    }
+    U32 result = 0;
+    while (result < len && (U64)this->pos < entry->uncompressedSize) {
+        FsZipCacheKey key;
+        key.zip = fsZip.get();
+        key.entryOffset = this->offset;
+        key.block = (U32)(this->pos / FS_ZIP_CACHE_BLOCK_SIZE);
+
+        FsZipCacheBlock block = FsZipBlockCache::get(key);
+        if (!block) {
+            U64 blockPos = (U64)key.block * FS_ZIP_CACHE_BLOCK_SIZE;
+            block = std::make_shared<std::vector<U8>>((U32)std::min<U64>(FS_ZIP_CACHE_BLOCK_SIZE, entry->uncompressedSize - blockPos));
+            FsZipReaderLease lease(fsZip, entry, blockPos);
+            if (lease.reader->read(entry, blockPos, block->data(), (U32)block->size()) != block->size()) {
+                break;
+            }
+            FsZipBlockCache::put(key, block);
+        }
+        U32 offsetInBlock = (U32)(this->pos % FS_ZIP_CACHE_BLOCK_SIZE);
+        U32 todo = std::min(len - result, (U32)block->size() - offsetInBlock);
+        memcpy(buffer + result, block->data() + offsetInBlock, todo);
+        result += todo;
+        this->pos += todo;
     }
     return result;
 }
@@ -112,12 +154,10 @@ void FsZipOpenNode::reopen() {
     this->pos = 0;
 }
 
-BOXEDWINE_MUTEX* FsZipOpenNode::getReadMutex() {
-    std::shared_ptr<FsZip> fsZip = zipNode->fsZip.lock();
-    if (fsZip) {
-        return &fsZip->readMutex;
-    }
-    return nullptr;
+U32 FsZipOpenNode::read(KThread* thread, U32 address, U32 len) {
+    // the whole read holds the node so it isn't interleaved with another read of the same file
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(readMutex);
+    return FsOpenNode::read(thread, address, len);
 }
 
 #endif
@@ -22,6 +22,7 @@
 #include "fsopennode.h"
 
 class FsZipNode;
+class FsZipEntry;
 
 class FsZipOpenNode : public FsOpenNode {
 public:
@@ -45,12 +46,14 @@ public:
     void close() override;
     void reopen() override;
     bool isOpen() override;
-    BOXEDWINE_MUTEX* getReadMutex() override;
+    U32 read(KThread* thread, U32 address, U32 len) override;
 
 private:
     std::shared_ptr<FsZipNode> zipNode;
     S64 pos;
-    U64 offset;    
+    U64 offset;
+    std::shared_ptr<FsZipEntry> entry;
+    BOXEDWINE_MUTEX readMutex;
 };
 
 #endif
\ No newline at end of file
@@ -23,13 +23,15 @@
 
 #include <string.h>
 
-KEPoll::KEPoll() : KObject(KTYPE_EPOLL) {
+KEPoll::KEPoll() : KObject(KTYPE_EPOLL), ready(std::make_shared<ReadyList>()), cond(std::make_shared<BoxedWineCondition>(B("KEPoll::cond"))) {
 }
 
 KEPoll::~KEPoll() {
-     for( const auto& n : this->data ) {
-         delete n.value;
+    for (const auto& n : this->data) {
+        unwatch(n.value);
     }
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(ready->mutex);
+    ready->list.clear();
 }
 
 void KEPoll::setBlocking(bool blocking) {
@@ -134,6 +136,49 @@ void KEPoll::close() {
 #define K_EPOLL_CTL_DEL 2
 #define K_EPOLL_CTL_MOD 3
 
+#define K_EPOLLONESHOT (1u << 30)
+#define K_EPOLLET (1u << 31)
+
+void KEPoll::ReadyList::add(const std::shared_ptr<Data>& d) {
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(mutex);
+    if (!d->ready && !d->removed) {
+        d->ready = true;
+        list.push_back(d);
+    }
+}
+
+void KEPoll::watch(const std::shared_ptr<Data>& d, const std::shared_ptr<KObject>& kobject) {
+    if (!d->watchCond) {
+        d->watchCond = std::make_shared<BoxedWineCondition>(B("KEPoll::watchCond"));
+        BOXEDWINE_CONDITION_ADD_PARENT(d->watchCond, this->cond);
+
+        // when the object signals a state change, the entry goes on the ready list and this->cond is signaled as the parent
+        std::weak_ptr<Data> weakData = d;
+        std::shared_ptr<ReadyList> readyList = this->ready;
+        d->watchCond->onSignal = [weakData, readyList]() {
+            std::shared_ptr<Data> d = weakData.lock();
+            if (d) {
+                readyList->add(d);
+            }
+        };
+    }
+    // like internal_poll, always respond to POLLERR and POLLHUP
+    kobject->waitForEvents(d->watchCond, (d->events & (K_POLLIN | K_POLLOUT | K_POLLPRI)) | K_POLLERR);
+    // the object might already be ready, it will be checked on the next wait
+    this->ready->add(d);
+}
+
+void KEPoll::unwatch(const std::shared_ptr<Data>& d) {
+    {
+        BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(ready->mutex);
+        d->removed = true;
+    }
+    std::shared_ptr<KObject> kobject = d->kobject.lock();
+    if (kobject && d->watchCond) {
+        kobject->waitForEvents(d->watchCond, 0);
+    }
+}
+
 U32 KEPoll::ctl(KMemory* memory, U32 op, FD fd, U32 address) {
     KFileDescriptorPtr targetFD = KThread::currentThread()->process->getFileDescriptor(fd);
 
@@ -141,30 +186,44 @@ U32 KEPoll::ctl(KMemory* memory, U32 op, FD fd, U32 address) {
         return -K_EBADF;
     }
 
-    Data* existing = this->data[fd];
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(dataMutex);
+    std::shared_ptr<Data> existing = this->data.get(fd);
 
+    // entries belong to the object, not the fd number, if the fd was closed and reused the old entry is gone
+    if (existing && existing->kobject.lock() != targetFD->kobject) {
+        unwatch(existing);
+        this->data.remove(fd);
+        existing = nullptr;
+    }
     switch (op) {
         case K_EPOLL_CTL_ADD:
             if (existing) {
                 return -K_EEXIST;
             }
-            existing = new Data();
+            existing = std::make_shared<Data>();
             existing->fd = fd;
             existing->events = memory->readd(address);
             existing->data = memory->readq(address + 4);
+            existing->kobject = targetFD->kobject;
             this->data.set(fd, existing);
+            watch(existing, targetFD->kobject);
             break;
         case K_EPOLL_CTL_DEL:
             if (!existing)
                 return -K_ENOENT;
             this->data.remove(fd);
-            delete existing;
+            unwatch(existing);
             break;
         case K_EPOLL_CTL_MOD:
             if (!existing)
                 return -K_ENOENT;
-            existing->events = memory->readd(address);
-            existing->data = memory->readq(address + 4);
+            {
+                BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(ready->mutex);
+                existing->events = memory->readd(address);
+                existing->data = memory->readq(address + 4);
+                existing->disabled = false;
+            }
+            watch(existing, targetFD->kobject);
             break;
         default:
             return -K_EINVAL;
@@ -172,37 +231,99 @@ U32 KEPoll::ctl(KMemory* memory, U32 op, FD fd, U32 address) {
     return 0;
 }
 
+// only the entries on the ready list are looked at, an entry is put there when its object signals a change
+U32 KEPoll::getReadyEvents(KMemory* memory, U32 events, U32 maxevents) {
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(ready->mutex);
+    U32 result = 0;
+    U32 count = (U32)ready->list.size();
+
+    // each entry is checked at most once per call, level triggered entries that are still ready go to the back so that they don't starve the others
+    for (U32 i = 0; i < count && result < maxevents; i++) {
+        std::shared_ptr<Data> d = ready->list.front();
+        ready->list.pop_front();
+        d->ready = false;
+
+        std::shared_ptr<KObject> kobject = d->kobject.lock();
+        if (d->removed || d->disabled || !kobject) {
+            continue;
+        }
+        U32 revents = 0;
+        if (!kobject->isOpen()) {
+            revents |= K_POLLHUP;
+        }
+        if ((d->events & K_POLLPRI) && kobject->isPriorityReadReady()) {
+            revents |= K_POLLPRI;
+        }
+        if ((d->events & K_POLLIN) && kobject->isReadReady()) {
+            revents |= K_POLLIN;
+        }
+        if ((d->events & K_POLLOUT) && kobject->isWriteReady()) {
+            revents |= K_POLLOUT;
+        }
+        if (!revents) {
+            continue;
+        }
+        memory->writed(events + result * 12, revents);
+        memory->writeq(events + result * 12 + 4, d->data);
+        result++;
+        if (d->events & K_EPOLLONESHOT) {
+            d->disabled = true;
+        } else if (!(d->events & K_EPOLLET)) {
+            d->ready = true;
+            ready->list.push_back(d);
+        }
+    }
+    return result;
+}
+
 U32 KEPoll::wait(KThread* thread, U32 events, U32 maxevents, U32 timeout) {
-    S32 result = 0;
-    thread_local static KPollData pollData[256];
-    U32 pollCount=0;
     KMemory* memory = thread->memory;
 
-    for( const auto& n : this->data ) {
-        if (pollCount>=256) {
-            kpanic("Wasn't expect a poll count of more than 256");
-            break;
-        }
-        Data* next = n.value;
-        pollData[pollCount].events = next->events;
-        pollData[pollCount].fd = next->fd;
-        pollData[pollCount].data = next->data;
-        pollCount++;	
+    if (!maxevents) {
+        return -K_EINVAL;
     }
-    result = internal_poll(thread, pollData, pollCount, timeout);
-    if (result >= 0) {
-        result = 0;
-        for (U32 i=0;i<pollCount;i++) {
-            if (pollData[i].revents!=0) {
-                memory->writed(events + result * 12, pollData[i].revents);        
-                memory->writeq(events + result * 12 + 4, pollData[i].data);
-                result++;
-                if (result>=(S32)maxevents) {
-                    kwarn("possible starvation in epoll, more events are ready than can be received.");
-                    break;
-                }
-            }        
+    while (true) {
+        BOXEDWINE_CRITICAL_SECTION_WITH_CONDITION(this->cond);
+        bool interrupted = !thread->inSignal && thread->interrupted;
+
+        if (interrupted) {
+            thread->interrupted = false;
         }
+        U32 result = getReadyEvents(memory, events, maxevents);
+        if (result > 0) {
+            thread->condStartWaitTime = 0;
+            return result;
+        }
+        if (timeout == 0) {
+            return 0;
+        }
+        if (interrupted) {
+            thread->condStartWaitTime = 0;
+            return -K_EINTR;
+        }
+        if (!thread->condStartWaitTime) {
+            thread->condStartWaitTime = KSystem::getMilliesSinceStart();
+        } else {
+            U32 diff = KSystem::getMilliesSinceStart() - thread->condStartWaitTime;
+            if (diff > timeout) {
+                thread->condStartWaitTime = 0;
+                return 0;
+            }
+            timeout -= diff;
+        }
+        if (timeout > 0xF0000000) {
+            BOXEDWINE_CONDITION_WAIT(this->cond);
+        } else {
+            BOXEDWINE_CONDITION_WAIT_TIMEOUT(this->cond, timeout);
+        }
+#ifdef BOXEDWINE_MULTI_THREADED
+        if (KThread::currentThread()->terminating) {
+            return -K_EINTR;
+        }
+        if (KThread::currentThread()->startSignal) {
+            KThread::currentThread()->startSignal = false;
+            return -K_CONTINUE;
+        }
+#endif
     }
-    return result;
 }
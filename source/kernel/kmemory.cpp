@@ -23,11 +23,207 @@
 #include "../emulation/softmmu/soft_page.h"
 #include "../emulation/softmmu/soft_rw_page.h"
 #include "../emulation/softmmu/soft_copy_on_write_page.h"
+#include "crc.h"
+
+#include UNISTD
+#include <fcntl.h>
+#if defined(BOXEDWINE_POSIX) && defined(BOXEDWINE_64)
+#include <sys/mman.h>
+#endif
+
+#define PAGE_STORE_MAGIC 0x53505742 // BWPS
+#define PAGE_STORE_VERSION 1
+
+// first page of a page store file, followed by the bitmap of stored pages and then the pages
+class PageStoreHeader {
+public:
+    U32 magic;
+    U32 version;
+    U64 fileSize;
+    U64 lastModified;
+    U32 pageCount;
+    U32 nameLen;
+};
 
 MappedFileCache::~MappedFileCache() {
     for (RamPage& page : data) {
         ramPageRelease(page);
     }
+    if (nativePages) {
+        Platform::releaseNativeMemory(nativePages, (U64)nativeBlockCount * 64 * 1024);
+    }
+    if (storeHandle >= 0) {
+        ::close(storeHandle);
+    }
+}
+
+void MappedFileCache::init() {
+    if (initialized) {
+        return;
+    }
+    initialized = true;
+    canMapFile = file->openFile->canMapNative();
+    if (!canMapFile && !KSystem::pageCachePath.isEmpty()) {
+        openStore();
+    }
+}
+
+void MappedFileCache::openStore() {
+    std::shared_ptr<FsNode> node = file->openFile->node;
+    PageStoreHeader header = {};
+    header.magic = PAGE_STORE_MAGIC;
+    header.version = PAGE_STORE_VERSION;
+    header.fileSize = node->length();
+    header.lastModified = node->lastModified();
+    header.pageCount = (U32)data.size();
+    header.nameLen = name.length();
+    if (sizeof(PageStoreHeader) + header.nameLen > K_PAGE_SIZE) {
+        return;
+    }
+
+    // the name only needs to be unique enough, the header is checked before the store is used
+    BString storePath = KSystem::pageCachePath;
+    storePath += Fs::nativePathSeperator;
+    storePath += BString::valueOf((U32)crc32b((unsigned char*)name.c_str(), name.length()), 16);
+    storePath += "-";
+    storePath += BString::valueOf(header.fileSize, 16);
+    storePath += ".pages";
+
+    U32 bitmapLen = (header.pageCount + 7) / 8;
+    storeDataOffset = K_PAGE_SIZE + (((U64)bitmapLen + K_PAGE_SIZE - 1) & ~(U64)K_PAGE_MASK);
+    storeBitmap.resize(bitmapLen);
+
+    U8 buffer[K_PAGE_SIZE] = {};
+    storeHandle = ::open(storePath.c_str(), O_RDWR | O_BINARY);
+    if (storeHandle >= 0) {
+        bool valid = ::read(storeHandle, buffer, K_PAGE_SIZE) == K_PAGE_SIZE && !memcmp(buffer, &header, sizeof(PageStoreHeader)) && !memcmp(buffer + sizeof(PageStoreHeader), name.c_str(), header.nameLen);
+        if (valid && (U32)::read(storeHandle, storeBitmap.data(), bitmapLen) == bitmapLen) {
+            return;
+        }
+        ::close(storeHandle);
+        storeHandle = -1;
+    }
+
+    // new file or the file changed since it was stored.  Another instance may have the old store mapped, so it is never
+    // truncated in place, a new store is written next to it and renamed over it.  The old one lives on until it is unmapped.
+    BString tmpPath = storePath;
+    tmpPath += ".";
+    tmpPath += BString::valueOf(KSystem::getSystemTimeAsMicroSeconds() ^ (U64)(uintptr_t)this, 16);
+    tmpPath += ".tmp";
+    storeHandle = ::open(tmpPath.c_str(), O_RDWR | O_CREAT | O_EXCL | O_BINARY, 0666);
+    if (storeHandle < 0) {
+        klog_fmt("could not create page store %s: %s", tmpPath.c_str(), strerror(errno));
+        return;
+    }
+    memset(buffer, 0, K_PAGE_SIZE);
+    memcpy(buffer, &header, sizeof(PageStoreHeader));
+    memcpy(buffer + sizeof(PageStoreHeader), name.c_str(), header.nameLen);
+    memset(storeBitmap.data(), 0, bitmapLen);
+    if (::write(storeHandle, buffer, K_PAGE_SIZE) != K_PAGE_SIZE || (U32)::write(storeHandle, storeBitmap.data(), bitmapLen) != bitmapLen) {
+        ::close(storeHandle);
+        storeHandle = -1;
+        ::unlink(tmpPath.c_str());
+        return;
+    }
+#ifdef BOXEDWINE_MSVC
+    // rename won't replace an existing file on Windows
+    ::unlink(storePath.c_str());
+#endif
+    if (::rename(tmpPath.c_str(), storePath.c_str()) != 0) {
+        klog_fmt("could not replace page store %s: %s", storePath.c_str(), strerror(errno));
+        ::close(storeHandle);
+        storeHandle = -1;
+        ::unlink(tmpPath.c_str());
+    }
+}
+
+bool MappedFileCache::isPageStored(U32 page) {
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(mutex);
+    init();
+    return storeHandle >= 0 && page < data.size() && (storeBitmap[page >> 3] & (1 << (page & 7)));
+}
+
+bool MappedFileCache::readStoredPage(U32 page, U8* buffer) {
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(mutex);
+    init();
+    if (storeHandle < 0 || page >= data.size() || !(storeBitmap[page >> 3] & (1 << (page & 7)))) {
+        return false;
+    }
+    U64 pos = storeDataOffset + ((U64)page << K_PAGE_SHIFT);
+    return (U64)lseek64(storeHandle, pos, SEEK_SET) == pos && ::read(storeHandle, buffer, K_PAGE_SIZE) == K_PAGE_SIZE;
+}
+
+void MappedFileCache::storePages(U32 page, U32 count, const U8* buffer) {
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(mutex);
+    init();
+    if (storeHandle < 0 || page >= data.size()) {
+        return;
+    }
+    count = std::min(count, (U32)data.size() - page);
+    U64 pos = storeDataOffset + ((U64)page << K_PAGE_SHIFT);
+    U32 len = count << K_PAGE_SHIFT;
+    if ((U64)lseek64(storeHandle, pos, SEEK_SET) != pos || (U32)::write(storeHandle, buffer, len) != len) {
+        return;
+    }
+    // the pages are written before they are marked so that another instance sharing the store never sees a partial page
+    for (U32 i = page; i < page + count; i++) {
+        storeBitmap[i >> 3] |= (1 << (i & 7));
+    }
+    // merge in the pages other instances stored since this one read the bitmap so that writing it back doesn't clear them
+    U32 first = page >> 3;
+    U32 last = (page + count - 1) >> 3;
+    U8 stored[K_PAGE_SIZE];
+    U32 storedLen = std::min(last - first + 1, (U32)K_PAGE_SIZE);
+    if ((U64)lseek64(storeHandle, K_PAGE_SIZE + first, SEEK_SET) == K_PAGE_SIZE + first && (U32)::read(storeHandle, stored, storedLen) == storedLen) {
+        for (U32 i = 0; i < storedLen; i++) {
+            storeBitmap[first + i] |= stored[i];
+        }
+    }
+    if ((U64)lseek64(storeHandle, K_PAGE_SIZE + first, SEEK_SET) == K_PAGE_SIZE + first) {
+        static_cast<void>(::write(storeHandle, storeBitmap.data() + first, last - first + 1));
+    }
+}
+
+U8* MappedFileCache::getNativePage(U32 page) {
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(mutex);
+    init();
+    if (page >= data.size()) {
+        return nullptr;
+    }
+    U8* result = nullptr;
+    if (nativePages) {
+        result = nativePages + ((U64)page << (K_PAGE_SHIFT + 1));
+        if (nativePageMapped[page]) {
+            return result;
+        }
+    }
+#if defined(BOXEDWINE_POSIX) && defined(BOXEDWINE_64)
+    bool stored = storeHandle >= 0 && (storeBitmap[page >> 3] & (1 << (page & 7))) && sysconf(_SC_PAGESIZE) == K_PAGE_SIZE;
+#else
+    bool stored = false;
+#endif
+    if (!canMapFile && !stored) {
+        return nullptr;
+    }
+    if (!nativePages) {
+        // 2 pages per file page, one of them stays reserved so that an access that crosses a page boundary will fault like it does with ramPageAlloc
+        nativeBlockCount = (U32)((data.size() * 2 + 15) / 16);
+        nativePages = Platform::reserveNativeMemory64k(nativeBlockCount);
+        nativePageMapped.resize(data.size());
+        result = nativePages + ((U64)page << (K_PAGE_SHIFT + 1));
+    }
+    if (stored) {
+#if defined(BOXEDWINE_POSIX) && defined(BOXEDWINE_64)
+        if (mmap(result, K_PAGE_SIZE, PROT_READ, MAP_PRIVATE | MAP_FIXED, storeHandle, (off_t)(storeDataOffset + ((U64)page << K_PAGE_SHIFT))) == MAP_FAILED) {
+            return nullptr;
+        }
+#endif
+    } else if (!file->openFile->mapNativePage(result, (U64)page << K_PAGE_SHIFT)) {
+        canMapFile = false;
+        return nullptr;
+    }
+    nativePageMapped[page] = true;
+    return result;
 }
 
 void KMemory::shutdown() {
@@ -318,6 +514,37 @@ bool KMemory::canRead(U32 address, U32 len) {
     return result;
 }
 
+#ifdef BOXEDWINE_MULTI_THREADED
+#define LOCK_STRIPE_COUNT 64
+
+static BOXEDWINE_MUTEX lockStripes[LOCK_STRIPE_COUNT];
+
+U8* KMemory::getLockPtr(U32 address, U32 len) {
+    // an aligned access never crosses a page.  Code pages fall back to the stripe lock so that the write goes through
+    // writeb/w/d and removes the translated code with the memory mutex held
+    if (address & (len - 1)) {
+        return nullptr;
+    }
+    return getDataRamPtr(address, len);
+}
+
+KMemoryStripeLock::KMemoryStripeLock(U32 address, U32 len) {
+    U32 firstIndex = (address >> K_PAGE_SHIFT) % LOCK_STRIPE_COUNT;
+    U32 secondIndex = ((address + len - 1) >> K_PAGE_SHIFT) % LOCK_STRIPE_COUNT;
+
+    // always in the same order so that two threads can't each hold the stripe the other one wants
+    first = &lockStripes[std::min(firstIndex, secondIndex)];
+    second = &lockStripes[std::max(firstIndex, secondIndex)];
+    BOXEDWINE_MUTEX_LOCK((*first));
+    BOXEDWINE_MUTEX_LOCK((*second));
+}
+
+KMemoryStripeLock::~KMemoryStripeLock() {
+    BOXEDWINE_MUTEX_UNLOCK((*second));
+    BOXEDWINE_MUTEX_UNLOCK((*first));
+}
+#endif
+
 void KMemory::execvReset(bool cloneVM) {
     if (!cloneVM) {
 #ifdef BOXEDWINE_BINARY_TRANSLATOR
@@ -43,9 +43,9 @@ bool KProcessTimer::run() {
     bool result = false;
     if (this->resetMillies==0) {
         result = true;
-        this->millies = 0;
+        this->micros = 0;
     } else {
-        this->millies = this->resetMillies + KSystem::getMilliesSinceStart();
+        this->micros = (U64)this->resetMillies * 1000 + KSystem::getMicroCounter();
     }
     KProcessPtr p = this->process.lock();
     if (p) {
@@ -158,6 +158,7 @@ void KProcess::onExec(KThread* thread) {
 #ifdef BOXEDWINE_BINARY_TRANSLATOR
     returnToLoopAddress = nullptr;
     reTranslateChunkAddress = nullptr;
+    retranslateHotChunkAddress = nullptr;
     syncToHostAddress = nullptr;
     syncFromHostAddress = nullptr;
     doSingleOpAddress = nullptr;
@@ -673,23 +674,21 @@ U32 KProcess::getModuleEip(U32 eip) {
 }
 
 U32 KProcess::alarm(U32 seconds) {
-    U32 prev = this->timer.millies;
+    U64 prev = this->timer.micros;
     if (seconds == 0) {
-        if (this->timer.millies!=0) {
+        if (this->timer.micros!=0) {
             removeTimer(&this->timer);
-            this->timer.millies = 0;
+            this->timer.micros = 0;
         }
     } else {
         this->timer.resetMillies = 0;
-        if (this->timer.millies!=0) {
-            this->timer.millies = seconds*1000 + KSystem::getMilliesSinceStart();
-        } else {
-            this->timer.millies = seconds*1000 + KSystem::getMilliesSinceStart();
-            addTimer(&this->timer);
-        }
+        // addTimer will move the timer if it is already running
+        this->timer.micros = (U64)seconds * 1000000 + KSystem::getMicroCounter();
+        addTimer(&this->timer);
     }
     if (prev) {
-        return (prev - KSystem::getMilliesSinceStart())/1000;
+        U64 now = KSystem::getMicroCounter();
+        return prev > now ? (U32)((prev - now) / 1000000) : 0;
     }
     return 0;
 }
@@ -1397,7 +1396,8 @@ U32 KProcess::setitimer(U32 which, U32 newValue, U32 oldValue) {
         kpanic_fmt("setitimer which=%d not supported", which);
     }
     if (oldValue) {
-        U32 remaining = this->timer.millies - KSystem::getMilliesSinceStart();
+        U64 now = KSystem::getMicroCounter();
+        U32 remaining = (this->timer.micros > now) ? (U32)((this->timer.micros - now) / 1000) : 0;
 
         memory->writed(oldValue, this->timer.resetMillies / 1000);
         memory->writed(oldValue, (this->timer.resetMillies % 1000) * 1000);
@@ -1409,18 +1409,14 @@ U32 KProcess::setitimer(U32 which, U32 newValue, U32 oldValue) {
         U32 resetMillies = memory->readd(newValue) * 1000 + memory->readd(newValue + 4) / 1000;
 
         if (millies == 0) {
-            if (this->timer.millies!=0) {
+            if (this->timer.micros!=0) {
                 removeTimer(&this->timer);
-                this->timer.millies = 0;
+                this->timer.micros = 0;
             }
         } else {
             this->timer.resetMillies = resetMillies;			
-            if (this->timer.millies!=0) {
-                this->timer.millies = millies + KSystem::getMilliesSinceStart();
-            } else {
-                this->timer.millies = millies + KSystem::getMilliesSinceStart();
-                addTimer(&this->timer);
-            }
+            this->timer.micros = (U64)millies * 1000 + KSystem::getMicroCounter();
+            addTimer(&this->timer);
         }
     }	
     return 0;
@@ -20,57 +20,124 @@
 #include "../x11/x11.h"
 #include "knativeaudio.h"
 
-#ifdef BOXEDWINE_MULTI_THREADED
-static KList<KTimerCallback*> timers;
+// timers are kept in a binary min heap ordered by deadline, each timer knows where it is in the heap so that removing
+// or rescheduling one doesn't need a search
+static std::vector<KTimerCallback*> timerHeap;
 static BOXEDWINE_MUTEX timerMutex;
-void runTimers() {
-    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(timerMutex);
-    U32 millies = KSystem::getMilliesSinceStart();
-    timers.for_each([millies](KListNode<KTimerCallback*>* node) {
-        KTimerCallback* timer = node->data;
-
-        if (timer->millies <= millies) {
-            if (timer->run()) {
-                timer->node.remove();
-            }
-        }
-        });
-}
 
-U32 getNextTimer() {
-    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(timerMutex);
-    U32 millies = KSystem::getMilliesSinceStart();
-    U32 result = 0xFFFFFFFF;
+static void setTimerHeapSlot(U32 index, KTimerCallback* timer) {
+    timerHeap[index] = timer;
+    timer->heapIndex = index;
+}
 
-    timers.for_each([millies, &result](KListNode<KTimerCallback*>* node) {
-        KTimerCallback* timer = node->data;
-        U32 next = 0;
+static void timerHeapUp(U32 index) {
+    KTimerCallback* timer = timerHeap[index];
+    while (index > 0) {
+        U32 parent = (index - 1) / 2;
+        if (timerHeap[parent]->micros <= timer->micros) {
+            break;
+        }
+        setTimerHeapSlot(index, timerHeap[parent]);
+        index = parent;
+    }
+    setTimerHeapSlot(index, timer);
+}
 
-        if (timer->millies <= millies) {
-            next = 0;
+static void timerHeapDown(U32 index) {
+    KTimerCallback* timer = timerHeap[index];
+    U32 count = (U32)timerHeap.size();
+    while (true) {
+        U32 child = index * 2 + 1;
+        if (child >= count) {
+            break;
         }
-        else {
-            next = timer->millies - millies;
+        if (child + 1 < count && timerHeap[child + 1]->micros < timerHeap[child]->micros) {
+            child++;
         }
-        if (next < result) {
-            result = next;
+        if (timer->micros <= timerHeap[child]->micros) {
+            break;
         }
-        });
-    return result;
+        setTimerHeapSlot(index, timerHeap[child]);
+        index = child;
+    }
+    setTimerHeapSlot(index, timer);
 }
 
+static void timerHeapInsert(KTimerCallback* timer) {
+    timerHeap.push_back(timer);
+    timerHeapUp((U32)timerHeap.size() - 1);
+}
+
+static void timerHeapRemove(KTimerCallback* timer) {
+    U32 index = timer->heapIndex;
+    KTimerCallback* last = timerHeap.back();
+
+    timerHeap.pop_back();
+    timer->heapIndex = K_TIMER_NOT_QUEUED;
+    if (last != timer) {
+        setTimerHeapSlot(index, last);
+        if (index > 0 && timerHeap[(index - 1) / 2]->micros > last->micros) {
+            timerHeapUp(index);
+        } else {
+            timerHeapDown(index);
+        }
+    }
+}
+
+// if the timer is already active, it will be moved to its new time
 void addTimer(KTimerCallback* timer) {
     BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(timerMutex);
-    timers.addToBack(&timer->node);
+    if (timer->heapIndex != K_TIMER_NOT_QUEUED) {
+        timerHeapRemove(timer);
+    }
+    timerHeapInsert(timer);
     timer->active = true;
 }
 
 void removeTimer(KTimerCallback* timer) {
     BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(timerMutex);
-    timer->node.remove();
+    if (timer->heapIndex != K_TIMER_NOT_QUEUED) {
+        timerHeapRemove(timer);
+    }
     timer->active = false;
 }
-#else
+
+void runTimers() {
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(timerMutex);
+    U64 now = KSystem::getMicroCounter();
+    std::vector<KTimerCallback*> reschedule;
+
+    while (!timerHeap.empty() && timerHeap[0]->micros <= now) {
+        KTimerCallback* timer = timerHeap[0];
+        timerHeapRemove(timer);
+        if (timer->run()) {
+            timer->active = false;
+        } else if (timer->active && timer->heapIndex == K_TIMER_NOT_QUEUED) {
+            // run can remove or add the timer itself
+            reschedule.push_back(timer);
+        }
+    }
+    // added after the loop so that a timer that is still due can't keep the loop going
+    for (KTimerCallback* timer : reschedule) {
+        timerHeapInsert(timer);
+    }
+}
+
+// returns the number of milliseconds until the next timer, rounded up so that the caller doesn't wake before it's due
+U32 getNextTimer() {
+    BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(timerMutex);
+    if (timerHeap.empty()) {
+        return 0xFFFFFFFF;
+    }
+    U64 now = KSystem::getMicroCounter();
+    U64 next = timerHeap[0]->micros;
+    if (next <= now) {
+        return 0;
+    }
+    return (U32)std::min((next - now + 999) / 1000, (U64)0xFFFFFFFE);
+}
+
+#ifndef BOXEDWINE_MULTI_THREADED
 #include "kscheduler.h"
 #include "knativesystem.h"
 
@@ -80,17 +147,6 @@ void removeTimer(KTimerCallback* timer) {
 
 KList<KThread*> scheduledThreads;
 KList<KThread*> waitThreads;
-KList<KTimerCallback*> timers;
-
-void addTimer(KTimerCallback* timer) {
-    timers.addToBack(&timer->node);
-    timer->active = true;
-}
-
-void removeTimer(KTimerCallback* timer) {
-    timer->node.remove();
-    timer->active = false;
-}
 
 void scheduleThread(KThread* thread) {
 #ifdef _DEBUG
@@ -146,19 +202,6 @@ void runThreadSlice(KThread* thread) {
     cpu->instructionCount+=cpu->blockInstructionCount;
 }
 
-void runTimers() {
-    U32 millies = KSystem::getMilliesSinceStart();
-    timers.for_each([millies] (KListNode<KTimerCallback*>* node) {
-        KTimerCallback* timer = node->data;
-
-        if (timer->millies<=millies) {
-            if (timer->run()) {                
-                timer->node.remove();
-            }
-        }
-    });
-}
-
 extern U64 sysCallTime;
 U64 elapsedTimeMIPS;
 U64 elapsedInstructionsMIPS;
@@ -23,6 +23,7 @@
 #include "kscheduler.h"
 #include "../emulation/softmmu/soft_ram.h"
 #include "../emulation/cpu/normal/normalCPU.h"
+#include "../emulation/cpu/binaryTranslation/btChunkStore.h"
 #include "knativesystem.h"
 #include "pixelformat.h"
 #include "../io/fsfilenode.h"
@@ -63,6 +64,10 @@ U32 KSystem::wineMajorVersion;
 bool KSystem::disableHideCursor = false;
 bool KSystem::forceRelativeMouse = false;
 bool KSystem::cacheReads = false;
+U32 KSystem::zipCacheMB = DEFAULT_ZIP_CACHE_MB;
+U32 KSystem::faultAroundPages = DEFAULT_FAULT_AROUND_PAGES;
+BString KSystem::pageCachePath;
+BString KSystem::codeCachePath;
 
 #if defined(BOXEDWINE_X64) && !defined(BOXEDWINE_USE_SSE_FOR_FPU)
 bool KSystem::useF64 = false;
@@ -116,6 +121,9 @@ void KSystem::destroy() {
     DecodedOp::clearCache();
     NormalCPU::clearCache();
     KMemory::shutdown();
+#ifdef BOXEDWINE_BINARY_TRANSLATOR
+    BtChunkStore::shutdown();
+#endif
     XServer::shutdown();
     shutdownRam();
 #ifdef BOXEDWINE_MULTI_THREADED
@@ -589,6 +597,13 @@ U32 KSystem::shmget(KThread* thread, U32 key, U32 size, U32 flags) {
     return result->id;
 }
 
+std::shared_ptr<SHM> KSystem::getSHM(KThread* thread, U32 shmid) {
+    if (shmid & PRIVATE_SHMID) {
+        return thread->process->getSHM(shmid);
+    }
+    return publicShm[shmid];
+}
+
 #define SHM_RDONLY      010000  /* read-only access */
 #define SHM_RND         020000  /* round attach address to SHMLBA boundary */
 #define SHM_REMAP       040000  /* take-over region on attach */
@@ -598,12 +613,7 @@ U32 KSystem::shmat(KThread* thread, U32 shmid, U32 shmaddr, U32 shmflg, U32 rtnA
     U32 permissions = 0;
     std::shared_ptr<SHM> shm;
 
-    if (shmid & PRIVATE_SHMID) {
-        shm = thread->process->getSHM(shmid);
-    } else {
-        shm = publicShm[shmid];
-    }
-
+    shm = getSHM(thread, shmid);
     if (!shm) {
         return -K_EINVAL;
     }
@@ -660,12 +670,7 @@ U32 KSystem::shmctl(KThread* thread, U32 shmid, U32 cmd, U32 buf) {
     std::shared_ptr<SHM> shm;
     KMemory* memory = thread->memory;
 
-    if (shmid & PRIVATE_SHMID) {
-        shm = thread->process->getSHM(shmid);
-    } else {
-        shm = publicShm[shmid];
-    }
-
+    shm = getSHM(thread, shmid);
     if (!shm) {
         return -K_EINVAL;
     }
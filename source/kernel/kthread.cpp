@@ -29,8 +29,6 @@
 
 thread_local KThread* KThread::runningThread;
 
-BOXEDWINE_MUTEX_NR KThread::futexesMutex;
-
 KThread::~KThread() {  
     for (auto& callback : callbacksOnExit) {
         callback(id);
@@ -39,6 +37,7 @@ KThread::~KThread() {
     CPU* cpu = this->cpu;
     this->cpu = nullptr;
     delete cpu;
+    delete this->futexWaiter;
 }
 
 void KThread::cleanup() {
@@ -236,192 +235,275 @@ U32 KThread::signal(U32 signal, bool wait) {
 #define FUTEX_CLOCK_REALTIME	256
 #define FUTEX_CMD_MASK		~(FUTEX_PRIVATE_FLAG | FUTEX_CLOCK_REALTIME)
 
-struct futex {
+#define FUTEX_BITSET_MATCH_ANY 0xffffffff
+
+// the waiters are kept in a hash table of wait queues keyed by address.  The table is split into shards, each with its own
+// lock, so that unrelated futexes don't contend with each other
+#define FUTEX_SHARDS 64
+
+class KFutexWaiter {
 public:
-    futex() : cond(std::make_shared<BoxedWineCondition>(B("futex"))) {}
-    KThread* thread = nullptr;
-    U64 address = 0;  
+    KFutexWaiter(KThread* thread) : thread(thread), cond(std::make_shared<BoxedWineCondition>(B("futex"))), node(this) {}
+    KThread* const thread;
+    std::atomic<U64> key = 0; // FUTEX_REQUEUE can move the waiter to another key while it waits
     U32 expireTimeInMillies = 0;
     U32 mask = 0;
-    bool wake = false;
+    bool wake = false; // guarded by cond
+    bool waiting = false;
     BOXEDWINE_CONDITION cond;
+    KListNode<KFutexWaiter*> node;
 };
 
-#define MAX_FUTEXES 128
+class KFutexShard {
+public:
+    BOXEDWINE_MUTEX_NR mutex;
+    BHashTable<U64, KList<KFutexWaiter*>*> queues;
+};
 
-struct futex system_futex[MAX_FUTEXES];
+static KFutexShard futexShards[FUTEX_SHARDS];
 
-struct futex* getFutex(KThread* thread, U64 address) {
-    int i=0;
+static KFutexShard& getFutexShard(U64 key) {
+    return futexShards[(U32)((key >> 2) ^ (key >> 11) ^ (key >> 32)) & (FUTEX_SHARDS - 1)];
+}
 
-    for (i=0;i<MAX_FUTEXES;i++) {
-        if (system_futex[i].address == address && system_futex[i].thread==thread) {
-            return &system_futex[i];
-        }
+// private futexes are keyed by emulated address and process, host addresses never have the top bit set so they can't collide
+static U64 getFutexKey(KThread* thread, U32 addr, bool isPrivate) {
+    if (isPrivate) {
+        return 0x8000000000000000ull | ((U64)thread->process->id << 32) | addr;
     }
-    return nullptr;
+    return (U64)thread->memory->getRamPtr(addr, 4, false, true);
 }
 
-struct futex* allocFutex(KThread* thread, U64 address, U32 millies) {
-    BOXEDWINE_CRITICAL_SECTION;
-    int i=0;
-
-    for (i=0;i<MAX_FUTEXES;i++) {
-        if (system_futex[i].thread== nullptr) {
-            system_futex[i].thread = thread;
-            system_futex[i].address = address;
-            system_futex[i].expireTimeInMillies = millies;
-            system_futex[i].wake = false;
-            system_futex[i].mask = 0;
-            return &system_futex[i];
+// caller must hold the shard lock
+static void queueFutexWaiter(KFutexShard& shard, KFutexWaiter* f, U64 key) {
+    KList<KFutexWaiter*>* queue = shard.queues.get(key);
+    if (!queue) {
+        queue = new KList<KFutexWaiter*>();
+        shard.queues.set(key, queue);
+    }
+    f->key = key;
+    queue->addToBack(&f->node);
+}
+
+// caller must hold the shard lock
+static void unqueueFutexWaiter(KFutexShard& shard, KFutexWaiter* f) {
+    if (!f->node.isInList()) {
+        return;
+    }
+    f->node.remove();
+    KList<KFutexWaiter*>* queue = shard.queues.get(f->key);
+    if (queue && queue->isEmpty()) {
+        shard.queues.remove(f->key);
+        delete queue;
+    }
+}
+
+static void removeFutexWaiter(KFutexWaiter* f) {
+    // a requeue could move the waiter to another shard while this waits for the lock
+    while (true) {
+        KFutexShard& shard = getFutexShard(f->key);
+        BOXEDWINE_CRITICAL_SECTION_WITH_CONDITION_MUTEX(shard.mutex);
+        if (&shard == &getFutexShard(f->key)) {
+            unqueueFutexWaiter(shard, f);
+            break;
         }
     }
-    kpanic("ran out of futexes");
-    return nullptr;
+    f->waiting = false;
 }
 
-void freeFutex(struct futex* f) {
-    f->thread = nullptr;
-    f->address = 0;
+// caller must hold the shard lock
+static void wakeFutexWaiter(KFutexShard& shard, KFutexWaiter* f) {
+    unqueueFutexWaiter(shard, f);
+    BOXEDWINE_CRITICAL_SECTION_WITH_CONDITION(f->cond);
+    f->wake = true;
+    BOXEDWINE_CONDITION_SIGNAL(f->cond);
 }
 
-void KThread::clearFutexes() {
-    U32 i;
+// caller must hold the shard lock
+static U32 wakeFutexWaiters(KFutexShard& shard, U64 key, U32 count, U32 mask) {
+    KList<KFutexWaiter*>* queue = shard.queues.get(key);
+    U32 result = 0;
 
-    BOXEDWINE_CRITICAL_SECTION_WITH_CONDITION_MUTEX(KThread::futexesMutex);
-    for (i=0;i<MAX_FUTEXES;i++) {
-        if (system_futex[i].thread == this) {
-            freeFutex(&system_futex[i]);
+    // waking the last waiter will delete the queue
+    while (queue && result < count) {
+        KListNode<KFutexWaiter*>* node = queue->front();
+        while (node && !(node->data->mask & mask)) {
+            node = node->getNext();
+        }
+        if (!node) {
+            break;
         }
+        bool last = queue->size() == 1;
+        wakeFutexWaiter(shard, node->data);
+        result++;
+        if (last) {
+            break;
+        }
+    }
+    return result;
+}
+
+void KThread::clearFutexes() {
+    if (this->futexWaiter && this->futexWaiter->waiting) {
+        removeFutexWaiter(this->futexWaiter);
     }
 }
 
 U32 KThread::futex(U32 addr, U32 op, U32 value, U32 pTime, U32 val2, U32 val3, bool time64) {
-    U64 ramAddress = 0;
     U32 cmd = (op & FUTEX_CMD_MASK);
     bool isPrivate = (op & FUTEX_PRIVATE_FLAG) != 0;
+    U64 key = getFutexKey(this, addr, isPrivate);
 
-    if (isPrivate) {
-        ramAddress = addr;
-    } else {
-        ramAddress = (U64)memory->getRamPtr(addr, 4, false, true);
-    }
-    if (ramAddress == 0) {
+    if (key == 0) {
         kpanic_fmt("Could not find futex address: %0.8X", addr);
     }
-    /*
-    * from kernel source, if I ever implement one of these I need to note pTime actually contains val2
-    if (cmd == FUTEX_REQUEUE || cmd == FUTEX_CMP_REQUEUE ||
-        cmd == FUTEX_CMP_REQUEUE_PI || cmd == FUTEX_WAKE_OP)
-        val2 = (u32)(unsigned long)utime;
-        */
-    BOXEDWINE_CRITICAL_SECTION_WITH_CONDITION_MUTEX(KThread::futexesMutex);
     if (cmd ==FUTEX_WAIT || cmd == FUTEX_WAIT_BITSET) {
-        //klog("%x/%x futux WAIT addr=%x op=%x val=%x ram=%x", id, process->id, addr, op, value, (U32)ramAddress);
-        struct futex* f=getFutex(this, ramAddress);
-        U32 expireTime = 0xFFFFFFFF;
-
-        if (pTime != 0) {
-            if (time64) {
-                U64 seconds = memory->readq(pTime);
-                U32 nano = memory->readd(pTime + 8);
-
-                if (cmd == FUTEX_WAIT) {
-                    // FUTEX_WAIT timeout is relative
-                    expireTime = (U32)(seconds * 1000 + nano / 1000000);
+        //klog("%x/%x futux WAIT addr=%x op=%x val=%x key=%llx", id, process->id, addr, op, value, key);
+        if (!this->futexWaiter) {
+            this->futexWaiter = new KFutexWaiter(this);
+        }
+        KFutexWaiter* f = this->futexWaiter;
+
+        // single threaded builds will return from the wait and call this again, so the waiter might already be queued
+        if (!f->waiting) {
+            U32 expireTime = 0xFFFFFFFF;
+
+            if (pTime != 0) {
+                if (time64) {
+                    U64 seconds = memory->readq(pTime);
+                    U32 nano = memory->readd(pTime + 8);
+
+                    if (cmd == FUTEX_WAIT) {
+                        // FUTEX_WAIT timeout is relative
+                        expireTime = (U32)(seconds * 1000 + nano / 1000000);
+                    } else {
+                        expireTime = (U32)((seconds * 1000 + nano / 1000000) - KSystem::getSystemTimeAsMicroSeconds() / 1000);
+                    }
                 } else {
-                    expireTime = (U32)((seconds * 1000 + nano / 1000000) - KSystem::getSystemTimeAsMicroSeconds() / 1000);
+                    U32 seconds = memory->readd(pTime);
+                    U32 nano = memory->readd(pTime + 4);
+
+                    if (cmd == FUTEX_WAIT) {
+                        // FUTEX_WAIT timeout is relative
+                        expireTime = seconds * 1000 + nano / 1000000;
+                    } else {
+                        expireTime = (U32)((seconds * 1000 + nano / 1000000) - KSystem::getSystemTimeAsMicroSeconds() / 1000);
+                    }
                 }
-            } else {
-                U32 seconds = memory->readd(pTime);
-                U32 nano = memory->readd(pTime + 4);
-
-                if (cmd == FUTEX_WAIT) {
-                    // FUTEX_WAIT timeout is relative
-                    expireTime = seconds * 1000 + nano / 1000000;
-                } else {
-                    expireTime = (U32)((seconds * 1000 + nano / 1000000) - KSystem::getSystemTimeAsMicroSeconds() / 1000);
-                }                                
+                expireTime += KSystem::getMilliesSinceStart();
             }
-            expireTime += KSystem::getMilliesSinceStart();
-        }
-        if (!f) {            
+            if (cmd == FUTEX_WAIT_BITSET && !val3) {
+                return -K_EINVAL;
+            }
+            KFutexShard& shard = getFutexShard(key);
+            BOXEDWINE_CRITICAL_SECTION_WITH_CONDITION_MUTEX(shard.mutex);
+            // checked while holding the shard lock so that a wake between the check and queuing the waiter isn't lost
             U32 currentValue = memory->readd(addr);
             if (currentValue != value) {
-                //klog("   %x/%x futux addr=%x op=%x val=%x ram=%x NEW VALUE %x", id, process->id, addr, op, value, (U32)ramAddress, currentValue);
+                //klog("   %x/%x futux addr=%x op=%x val=%x key=%llx NEW VALUE %x", id, process->id, addr, op, value, key, currentValue);
                 return -K_EWOULDBLOCK;
             }
-
-            f = allocFutex(this, ramAddress, expireTime);
-            if (cmd == FUTEX_WAIT_BITSET) {
-                f->mask = val3;
-            }
+            f->expireTimeInMillies = expireTime;
+            f->mask = (cmd == FUTEX_WAIT_BITSET) ? val3 : FUTEX_BITSET_MATCH_ANY;
+            f->wake = false;
+            f->waiting = true;
+            queueFutexWaiter(shard, f, key);
         }
+        U32 result = 0;
         while (true) {                        
             if (this->pendingSignals) {
                 // I know this is a nested if statement, but it makes setting a break point easier
                 if (runSignals()) {
-                    //klog("   %x/%x futux addr=%x op=%x val=%x ram=%x RAN SIGNAL", id, process->id, addr, op, value, (U32)ramAddress);
-                    freeFutex(f);
-                    return -K_CONTINUE;
+                    //klog("   %x/%x futux addr=%x op=%x val=%x key=%llx RAN SIGNAL", id, process->id, addr, op, value, key);
+                    result = -K_CONTINUE;
+                    break;
                 }
             }
-            if (f->wake) {
-                freeFutex(f);
-                return 0;
-            }
-            U32 currentValue = memory->readd(addr);
-            if (currentValue != value) {
-                //klog("   %x/%x futux addr=%x op=%x val=%x ram=%x NEW VALUE 2nd try %x", id, process->id, addr, op, value, (U32)ramAddress, currentValue);
-                freeFutex(f);
-                return -K_EWOULDBLOCK;
-            }
-            if (f->expireTimeInMillies<0x7FFFFFFF) {
-                S32 diff = f->expireTimeInMillies - KSystem::getMilliesSinceStart();
-                if (diff<=0) {
-                    freeFutex(f);
-                    return -K_ETIMEDOUT;
+            {
+                BOXEDWINE_CRITICAL_SECTION_WITH_CONDITION(f->cond);
+                if (f->wake) {
+                    result = 0;
+                    break;
+                }
+                U32 currentValue = memory->readd(addr);
+                if (currentValue != value) {
+                    //klog("   %x/%x futux addr=%x op=%x val=%x key=%llx NEW VALUE 2nd try %x", id, process->id, addr, op, value, key, currentValue);
+                    result = -K_EWOULDBLOCK;
+                    break;
+                }
+                if (f->expireTimeInMillies < 0x7FFFFFFF) {
+                    S32 diff = f->expireTimeInMillies - KSystem::getMilliesSinceStart();
+                    if (diff <= 0) {
+                        result = -K_ETIMEDOUT;
+                        break;
+                    }
+                    BOXEDWINE_CONDITION_WAIT_TIMEOUT(f->cond, (U32)diff);
+                } else {
+                    BOXEDWINE_CONDITION_WAIT(f->cond);
                 }
-                //klog("   %x/%x futux SLEEPING %x addr=%x op=%x val=%x ram=%x", id, process->id, (U32)diff, addr, op, value, (U32)ramAddress);
-                BOXEDWINE_CONDITION_WAIT_TIMEOUT(f->cond, (U32)diff);
-                //klog("   %x/%x futux DONE SLEEPING %x addr=%x op=%x val=%x ram=%x wake=%d", id, process->id, (U32)diff, addr, op, value, (U32)ramAddress, f->wake);
-            } else {
-                //klog("   %x/%x futux SLEEPING addr=%x op=%x val=%x ram=%x", id, process->id, addr, op, value, (U32)ramAddress);
-                BOXEDWINE_CONDITION_WAIT(f->cond);
-                //klog("   %x/%x futux DONE SLEEPING addr=%x op=%x val=%x ram=%x wake=%d", id, process->id, addr, op, value, (U32)ramAddress, f->wake);
             }
 #ifdef BOXEDWINE_MULTI_THREADED
 			if (this->terminating) {
-                freeFutex(f);
-				return -K_EINTR;
+                result = -K_EINTR;
+                break;
 			}
             if (KThread::currentThread()->startSignal) {
                 KThread::currentThread()->startSignal = false;
-                freeFutex(f);
-                return -K_CONTINUE;
+                result = -K_CONTINUE;
+                break;
             }
 #endif
         }
+        removeFutexWaiter(f);
+        return result;
     } else if (cmd ==FUTEX_WAKE || cmd == FUTEX_WAKE_BITSET) {
-        U32 count = 0;
-        //klog("%x/%x futux wake addr=%x op=%x val=%x ram=%x", id, process->id, addr, op, value, (U32)ramAddress);
-        {            
-            for (int i = 0; i < MAX_FUTEXES && count < value; i++) {
-                if (!system_futex[i].thread) {
-                    continue;
-                }
-                bool processCheck = (!isPrivate || system_futex[i].thread->process->id == this->process->id);
-                bool addressCheck = system_futex[i].address == ramAddress;
-                bool maskCheck = ((cmd != FUTEX_WAKE_BITSET) || (system_futex[i].mask & val3));
-                if (processCheck && addressCheck && !system_futex[i].wake && maskCheck) {
-                    system_futex[i].wake = true;
-                    BOXEDWINE_CONDITION_SIGNAL(system_futex[i].cond);
-                    count++;
+        //klog("%x/%x futux wake addr=%x op=%x val=%x key=%llx", id, process->id, addr, op, value, key);
+        if (cmd == FUTEX_WAKE_BITSET && !val3) {
+            return -K_EINVAL;
+        }
+        KFutexShard& shard = getFutexShard(key);
+        BOXEDWINE_CRITICAL_SECTION_WITH_CONDITION_MUTEX(shard.mutex);
+        return wakeFutexWaiters(shard, key, value, (cmd == FUTEX_WAKE_BITSET) ? val3 : FUTEX_BITSET_MATCH_ANY);
+    } else if (cmd == FUTEX_REQUEUE || cmd == FUTEX_CMP_REQUEUE) {
+        // pTime holds the number of waiters to requeue and val2 is the address of the second futex
+        U64 key2 = getFutexKey(this, val2, isPrivate);
+        if (key2 == 0) {
+            return -K_EFAULT;
+        }
+        KFutexShard& shard = getFutexShard(key);
+        KFutexShard& shard2 = getFutexShard(key2);
+
+        // always lock in the same order
+        KFutexShard* first = &shard < &shard2 ? &shard : &shard2;
+        KFutexShard* second = &shard < &shard2 ? &shard2 : &shard;
+        BOXEDWINE_MUTEX_LOCK(first->mutex);
+        if (second != first) {
+            BOXEDWINE_MUTEX_LOCK(second->mutex);
+        }
+        U32 result = 0;
+        if (cmd == FUTEX_CMP_REQUEUE && memory->readd(addr) != val3) {
+            result = -K_EAGAIN;
+        } else {
+            result = wakeFutexWaiters(shard, key, value, FUTEX_BITSET_MATCH_ANY);
+            if (key != key2) {
+                KList<KFutexWaiter*>* queue = shard.queues.get(key);
+                for (U32 i = 0; queue && i < pTime; i++) {
+                    KFutexWaiter* f = queue->front()->data;
+                    bool last = queue->size() == 1;
+                    unqueueFutexWaiter(shard, f);
+                    queueFutexWaiter(shard2, f, key2);
+                    result++;
+                    if (last) {
+                        break;
+                    }
                 }
             }
         }
-        //klog("    %x/%x futux wake finished addr=%x op=%x val=%x ram=%x count=%d", id, process->id, addr, op, value, (U32)ramAddress, count);
-        return count;
+        if (second != first) {
+            BOXEDWINE_MUTEX_UNLOCK(second->mutex);
+        }
+        BOXEDWINE_MUTEX_UNLOCK(first->mutex);
+        return result;
     } else {
         kwarn_fmt("syscall __NR_futex op %d not implemented", op);
         return -1;
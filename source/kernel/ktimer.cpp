@@ -27,7 +27,7 @@ bool KRunTimer::run() {
     } else {
         U64 now = KSystem::getSystemTimeAsMicroSeconds();
         timer->microNextTimer = now + timer->microInterval;
-        this->millies = (U32)(timer->microInterval / 1000) + KSystem::getMilliesSinceStart();
+        this->micros = timer->microInterval + KSystem::getMicroCounter();
         return false; // keep timer going
     }
 }
@@ -183,11 +183,11 @@ void KTimer::setTimes(U64 microInterval, U64 microNextTimer) {
         numberOfExpirations++;
         if (microInterval) {
             microNextTimer = now + microInterval;
-            timer.millies = (U32)(microInterval / 1000) + KSystem::getMilliesSinceStart();
+            timer.micros = microInterval + KSystem::getMicroCounter();
             addTimer(&timer);
         }
     } else {
-        timer.millies = (U32)(diff / 1000) + KSystem::getMilliesSinceStart();
+        timer.micros = diff + KSystem::getMicroCounter();
         addTimer(&timer);
     }
 }
\ No newline at end of file
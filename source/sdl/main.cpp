@@ -32,12 +32,6 @@
 
 #ifndef __TEST
 
-U32 gensrc;
-
-#ifdef GENERATE_SOURCE
-void writeSource();
-#endif
-
 int boxedmain(int argc, const char **argv) {
     StartUpArgs startupArgs;                  
 
@@ -22,9 +22,20 @@
 #include "../../ui/mainui.h"
 #endif
 #include "knativesystem.h"
+#include "../../emulation/softmmu/soft_file_map.h"
 #include "devfb.h"
 #include "../../x11/x11.h"
 #include "platformOpenGL.h"
+#ifdef BOXEDWINE_ZLIB
+#include "../../io/fszip.h"
+#endif
+#if defined(BOXEDWINE_BINARY_TRANSLATOR)
+#include "../../emulation/softmmu/kmemory_soft.h"
+#endif
+#if defined(BOXEDWINE_X64)
+#include "../../emulation/cpu/x64/x64Asm.h"
+#endif
+#include "../../emulation/cpu/normal/normalCPU.h"
 
 U32 getNextTimer();
 void runTimers();
@@ -126,6 +137,26 @@ bool doMainLoop() {
                 title = B("BoxedWine " BOXEDWINE_VERSION_DISPLAY " ");
                 title.append(getSize(allocatedRamPages));
             }
+#if defined(_DEBUG)
+            title.append(" ");
+            title.append(FilePage::getStats());
+#if defined(BOXEDWINE_ZLIB)
+            title.append(" ");
+            title.append(FsZip::getStats());
+#endif
+#if defined(BOXEDWINE_BINARY_TRANSLATOR)
+            title.append(" ");
+            title.append(BtMemory::getStats());
+#endif
+#if defined(BOXEDWINE_X64)
+            title.append(" ");
+            title.append(X64Asm::getIndirectJumpStats());
+#endif
+            title.append(" ");
+            title.append(DecodedOp::getPoolStats());
+            title.append(" ");
+            title.append(NormalCPU::getPoolStats());
+#endif
 
             KNativeSystem::getScreen()->setTitle(title);
         }
@@ -27,6 +27,8 @@
 #include "../../ui/mainui.h"
 #endif
 
+U32 getNextTimer();
+
 static U32 lastTitleUpdate = 0;
 bool isMainthread() {
     return true;
@@ -96,8 +98,10 @@ bool doMainLoop() {
             if (KSystem::getRunningProcessCount()==0) {
                 break;
             }
-            if (!checkWaitingNativeSockets(20)) {
-                KNativeThread::sleep(20);
+            // don't sleep past the next timer
+            U32 timeout = std::min(20u, getNextTimer());
+            if (!checkWaitingNativeSockets(timeout)) {
+                KNativeThread::sleep(timeout);
             }
         }
     }
@@ -269,6 +269,22 @@ std::vector<BString> StartUpArgs::buildArgs() {
     if (this->cacheReads) {
         args.push_back(B("-cacheReads"));
     }
+    if (this->zipCacheMB != DEFAULT_ZIP_CACHE_MB) {
+        args.push_back(B("-zipCacheMB"));
+        args.push_back(BString::valueOf(this->zipCacheMB));
+    }
+    if (this->faultAroundPages != DEFAULT_FAULT_AROUND_PAGES) {
+        args.push_back(B("-faultAroundPages"));
+        args.push_back(BString::valueOf(this->faultAroundPages));
+    }
+    if (!this->pageCachePath.isEmpty()) {
+        args.push_back(B("-pageCache"));
+        args.push_back(this->pageCachePath);
+    }
+    if (!this->codeCachePath.isEmpty()) {
+        args.push_back(B("-codeCache"));
+        args.push_back(this->codeCachePath);
+    }
     for (auto& a : this->args) {
         args.push_back(a);
     }
@@ -286,6 +302,10 @@ bool StartUpArgs::apply() {
     KSystem::disableHideCursor = this->disableHideCursor;
     KSystem::forceRelativeMouse = this->forceRelativeMouse;
     KSystem::cacheReads = this->cacheReads;
+    KSystem::zipCacheMB = this->zipCacheMB;
+    KSystem::faultAroundPages = this->faultAroundPages;
+    KSystem::pageCachePath = this->pageCachePath;
+    KSystem::codeCachePath = this->codeCachePath;
     KSystem::pentiumLevel = this->pentiumLevel;
     KSystem::pollRate = this->pollRate;
     if (KSystem::pollRate < 0) {
@@ -583,10 +603,6 @@ bool StartUpArgs::apply() {
             }
         }
     }
-#ifdef GENERATE_SOURCE
-    if (gensrc)
-        writeSource();
-#endif    
 	KSystem::destroy();
     KNativeSystem::shutdown();
     KNativeAudio::shutdown();
@@ -813,6 +829,32 @@ bool StartUpArgs::parseStartupArgs(int argc, const char **argv) {
             this->forceRelativeMouse = true;
         }  else if (!strcmp(argv[i], "-cacheReads")) {
             this->cacheReads = true;
+        } else if (!strcmp(argv[i], "-zipCacheMB") && i + 1 < argc) {
+            this->zipCacheMB = atoi(argv[i + 1]);
+            i++;
+        } else if (!strcmp(argv[i], "-faultAroundPages") && i + 1 < argc) {
+            this->faultAroundPages = atoi(argv[i + 1]);
+            i++;
+        } else if (!strcmp(argv[i], "-pageCache") && i + 1 < argc) {
+            if (!Fs::doesNativePathExist(BString::copy(argv[i + 1]))) {
+                static_cast<void>(MKDIR(argv[i + 1])); // return result ignored
+                if (!Fs::doesNativePathExist(BString::copy(argv[i + 1]))) {
+                    klog_fmt("-pageCache path does not exist and could not be created: %s", argv[i + 1]);
+                    return false;
+                }
+            }
+            this->pageCachePath = BString::copy(argv[i + 1]);
+            i++;
+        } else if (!strcmp(argv[i], "-codeCache") && i + 1 < argc) {
+            if (!Fs::doesNativePathExist(BString::copy(argv[i + 1]))) {
+                static_cast<void>(MKDIR(argv[i + 1])); // return result ignored
+                if (!Fs::doesNativePathExist(BString::copy(argv[i + 1]))) {
+                    klog_fmt("-codeCache path does not exist and could not be created: %s", argv[i + 1]);
+                    return false;
+                }
+            }
+            this->codeCachePath = BString::copy(argv[i + 1]);
+            i++;
         }
         else if (!strcmp(argv[i], "-dxvk")) {
             BString dxvk;
@@ -115,6 +115,10 @@ public:
     bool disableHideCursor = false;
     bool forceRelativeMouse = false;
     bool cacheReads = false;
+    U32 zipCacheMB = DEFAULT_ZIP_CACHE_MB;
+    U32 faultAroundPages = DEFAULT_FAULT_AROUND_PAGES;
+    BString pageCachePath;
+    BString codeCachePath;
 
 private:
     bool workingDirSet = false;
@@ -21,9 +21,16 @@
 #ifdef __TEST
 #include <stdlib.h>
 #include <stdio.h>
+#include MKDIR_INCLUDE
 
+#include "../emulation/softmmu/kmemory_soft.h"
 #include "../emulation/cpu/binaryTranslation/btCpu.h"
+#include "../emulation/cpu/binaryTranslation/btChunkStore.h"
+#include "../emulation/cpu/normal/normalCPU.h"
+#include "../util/ptrpool.h"
+#include "../util/damageregion.h"
 #include "knativethread.h"
+#include "ksignal.h"
 
 #if defined(BOXEDWINE_MSVC) && !defined (BOXEDWINE_64)
 #include <nmmintrin.h>
@@ -9808,6 +9815,794 @@ void testSplitPageWrite() {
     assertTrue(AX == 0x5678);
 }
 
+// rep string ops that cross pages, overlap and run backwards, ES and DS are both the heap
+void testRepStringsAcrossPages() {
+    cpu->big = true;
+
+    // rep movsd over 2 page boundaries
+    for (U32 i = 0; i < 0x500; i++) {
+        memory->writed(HEAP_ADDRESS + 0xff0 + i * 4, i);
+    }
+    strTest(4, 0xf3, 0xa5, 0, NULL, 0, NULL, 0, 0xff0, 0x4ff8, 0x500, 0x23f0, 0x63f8, 0, false, false, false, HEAP_ADDRESS);
+    for (U32 i = 0; i < 0x500; i++) {
+        assertTrue(memory->readd(HEAP_ADDRESS + 0x4ff8 + i * 4) == i);
+    }
+
+    // rep movsb where dst is 1 past src repeats the first byte instead of acting like memmove
+    memory->writeb(HEAP_ADDRESS + 0x8000, 0x5a);
+    memory->writeb(HEAP_ADDRESS + 0x8001, 0x11);
+    strTest(1, 0xf3, 0xa4, 0, NULL, 0, NULL, 0, 0x8000, 0x8001, 0x1800, 0x9800, 0x9801, 0, false, false, false, HEAP_ADDRESS);
+    for (U32 i = 0; i < 0x1801; i++) {
+        assertTrue(memory->readb(HEAP_ADDRESS + 0x8000 + i) == 0x5a);
+    }
+
+    // rep movsd with DF, the unaligned dst has an element that crosses the page
+    for (U32 i = 0; i < 0x10; i++) {
+        memory->writed(HEAP_ADDRESS + 0xa004 - i * 4, i + 1);
+    }
+    strTest(4, 0xf3, 0xa5, DF, NULL, 0, NULL, 0, 0xa004, 0xc002, 0x10, 0x9fc4, 0xbfc2, 0, false, false, false, HEAP_ADDRESS);
+    for (U32 i = 0; i < 0x10; i++) {
+        assertTrue(memory->readd(HEAP_ADDRESS + 0xc002 - i * 4) == i + 1);
+    }
+
+    // rep stosd
+    strTest(4, 0xf3, 0xab, 0, NULL, 0, NULL, 0, 0, 0xeff0, 8, 0, 0xf010, 0, false, false, false, HEAP_ADDRESS, 0x11223344);
+    for (U32 i = 0; i < 8; i++) {
+        assertTrue(memory->readd(HEAP_ADDRESS + 0xeff0 + i * 4) == 0x11223344);
+    }
+
+    // repz cmpsb stops on the next page
+    for (U32 i = 0; i < 0x40; i++) {
+        memory->writeb(HEAP_ADDRESS + 0x10ff8 + i, (U8)i);
+        memory->writeb(HEAP_ADDRESS + 0x12ff8 + i, (U8)i);
+    }
+    memory->writeb(HEAP_ADDRESS + 0x12ff8 + 0x18, 0xff);
+    strTest(1, 0xf3, 0xa6, 0, NULL, 0, NULL, 0, 0x10ff8, 0x12ff8, 0x40, 0x11011, 0x13011, 0x27, true, true, false, HEAP_ADDRESS);
+
+    // repnz scasb finds al on the next page
+    memory->writeb(HEAP_ADDRESS + 0x14ff0 + 0x30, 0x77);
+    strTest(1, 0xf2, 0xae, 0, NULL, 0, NULL, 0, 0, 0x14ff0, 0x100, 0, 0x15021, 0xcf, true, false, true, HEAP_ADDRESS, 0x77);
+
+#ifndef BOXEDWINE_BINARY_TRANSLATOR
+    // rep stos and movs over translated code only remove it when a byte changes
+    newInstruction(0);
+    cseip = CODE_ADDRESS + 0x100;
+    cpu->eip.u32 = 0x100;
+    for (U32 i = 0; i < 4; i++) {
+        pushCode8(0x90); // nop
+    }
+    runTestCPU();
+    assertTrue(memory->findCodeBlockContaining(CODE_ADDRESS + 0x100, 4) != nullptr);
+    strTest(1, 0xf3, 0xaa, 0, NULL, 0, NULL, 0, 0, 0x100, 4, 0, 0x104, 0, false, false, false, CODE_ADDRESS, 0x90);
+    assertTrue(memory->findCodeBlockContaining(CODE_ADDRESS + 0x100, 4) != nullptr);
+    memory->writed(HEAP_ADDRESS + 0x16000, 0x90909090);
+    strTest(1, 0xf3, 0xa4, 0, NULL, 0, NULL, 0, 0x16000, 0x100, 4, 0x16004, 0x104, 0, false, false, false, CODE_ADDRESS);
+    assertTrue(memory->findCodeBlockContaining(CODE_ADDRESS + 0x100, 4) != nullptr);
+    strTest(1, 0xf3, 0xaa, 0, NULL, 0, NULL, 0, 0, 0x100, 4, 0, 0x104, 0, false, false, false, CODE_ADDRESS, 0x40);
+    assertTrue(memory->findCodeBlockContaining(CODE_ADDRESS + 0x100, 4) == nullptr);
+    assertTrue(memory->readd(CODE_ADDRESS + 0x100) == 0x40404040);
+
+    // rep stosd that faults on the page after the heap, the signal context has ECX and EDI of the element that
+    // faulted and the elements before it were written
+    KSigAction savedAction = process->sigActions[K_SIGSEGV];
+    U32 savedStackMask = cpu->stackMask;
+    U32 savedStackNotMask = cpu->stackNotMask;
+    U32 startEDI = (PAGES_PER_SEG << K_PAGE_SHIFT) - 8;
+    bool faulted = false;
+
+    process->sigActions[K_SIGSEGV].handlerAndSigAction = CODE_ADDRESS;
+    process->sigActions[K_SIGSEGV].flags = K_SA_SIGINFO;
+    newInstruction(0xab, 0, 0xf3);
+    cpu->seg[ES].address = HEAP_ADDRESS;
+    EDI = startEDI;
+    ECX = 4;
+    EAX = 0x55667788;
+    try {
+        runTestCPU();
+    } catch (...) {
+        faulted = true;
+    }
+    assertTrue(faulted);
+    if (faulted) {
+        U32 context = EDX;
+        assertTrue(memory->readd(context + 0x3C) == 2); // ECX
+        assertTrue(memory->readd(context + 0x24) == startEDI + 8); // EDI
+    }
+    assertTrue(memory->readd(HEAP_ADDRESS + startEDI) == 0x55667788);
+    assertTrue(memory->readd(HEAP_ADDRESS + startEDI + 4) == 0x55667788);
+
+    process->sigActions[K_SIGSEGV] = savedAction;
+    cpu->thread->inSignal = 0;
+    cpu->stackMask = savedStackMask;
+    cpu->stackNotMask = savedStackNotMask;
+#endif
+}
+
+// objects that are put back are handed out again, from this thread's magazine or the shared free list, and an object
+// is never handed out twice
+void testPtrPool() {
+    static PtrPool<U32> pool(100);
+    std::set<U32*> seen;
+    std::vector<U32*> items;
+
+    for (int i = 0; i < 250; i++) {
+        U32* p = pool.get();
+        assertTrue(seen.insert(p).second);
+        items.push_back(p);
+    }
+    for (auto& p : items) {
+        pool.put(p);
+    }
+    std::set<U32*> again;
+    for (int i = 0; i < 250; i++) {
+        U32* p = pool.get();
+        assertTrue(again.insert(p).second);
+        seen.insert(p);
+    }
+    // 3 blocks of 100, the second pass only reused them
+    assertTrue(seen.size() <= 300);
+    assertTrue(pool.getStats("test").startsWith(B("test 300/")));
+    pool.deleteAll();
+
+#ifdef BOXEDWINE_MULTI_THREADED
+    std::atomic<bool> failed = false;
+    std::vector<std::thread> threads;
+
+    for (U32 t = 0; t < 4; t++) {
+        threads.push_back(std::thread([t, &failed]() {
+            U32* held[100];
+            for (U32 pass = 0; pass < 200; pass++) {
+                for (U32 i = 0; i < 100; i++) {
+                    held[i] = pool.get();
+                    *held[i] = t;
+                }
+                std::this_thread::yield();
+                for (U32 i = 0; i < 100; i++) {
+                    if (*held[i] != t) {
+                        failed = true;
+                    }
+                    pool.put(held[i]);
+                }
+            }
+        }));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    assertTrue(!failed);
+    pool.deleteAll();
+#endif
+}
+
+void testDamageRegion() {
+    DamageRegion region;
+    assertTrue(region.isEmpty());
+
+    // clipped to the drawable, nothing left means nothing added
+    region.add(-10, -10, 20, 20, 100, 100);
+    assertTrue(region.rects.size() == 1);
+    assertTrue(region.rects[0].left == 0 && region.rects[0].top == 0 && region.rects[0].right == 10 && region.rects[0].bottom == 10);
+    region.add(100, 0, 10, 10, 100, 100);
+    region.add(0, 0, 0, 10, 100, 100);
+    assertTrue(region.rects.size() == 1);
+
+    // touching rects merge, apart ones don't
+    region.add(10, 0, 10, 10, 100, 100);
+    assertTrue(region.rects.size() == 1);
+    assertTrue(region.rects[0].right == 20 && region.rects[0].bottom == 10);
+    region.add(50, 50, 10, 10, 100, 100);
+    assertTrue(region.rects.size() == 2);
+
+    // a rect that bridges two others merges them all
+    region.add(15, 5, 40, 50, 100, 100);
+    assertTrue(region.rects.size() == 1);
+    assertTrue(region.rects[0].left == 0 && region.rects[0].top == 0 && region.rects[0].right == 60 && region.rects[0].bottom == 60);
+
+    // past MAX_RECTS it collapses to the bounding box
+    region.clear();
+    assertTrue(region.isEmpty());
+    for (U32 i = 0; i < DamageRegion::MAX_RECTS; i++) {
+        region.add(i * 4, i * 4, 2, 2, 100, 100);
+    }
+    assertTrue(region.rects.size() == DamageRegion::MAX_RECTS);
+    region.add(90, 0, 2, 2, 100, 100);
+    assertTrue(region.rects.size() == 1);
+    assertTrue(region.rects[0].left == 0 && region.rects[0].top == 0 && region.rects[0].right == 92 && region.rects[0].bottom == 62);
+
+    region.addAll(30, 20);
+    assertTrue(region.rects.size() == 1);
+    assertTrue(region.rects[0].width() == 30 && region.rects[0].height() == 20);
+}
+
+// flags that are only read on the taken side of a branch must survive the memory check before the branch
+void testFlagsAcrossBranch() {
+    cpu->big = true;
+    newInstruction(0);
+    EAX = 1;
+    EBX = 0;
+
+    // cmp eax, 2
+    pushCode8(0x83);
+    pushCode8(0xf8);
+    pushCode8(0x02);
+
+    // mov edx, [esi]
+    pushCode8(0x8b);
+    pushCode8(0x16);
+
+    // jnz +3
+    pushCode8(0x75);
+    pushCode8(0x03);
+
+    // add ecx, 0
+    pushCode8(0x83);
+    pushCode8(0xc1);
+    pushCode8(0x00);
+
+    // setc bl
+    pushCode8(0x0f);
+    pushCode8(0x92);
+    pushCode8(0xc3);
+
+    runTestCPU();
+
+    assertTrue(BL == 1);
+}
+
+// the indirect jump caches and the return predictor are only used when CS can be ignored, the second run makes sure
+// that nothing cached by the first one is used after the code changes
+void testIndirectJumpCache() {
+    newInstruction(0);
+    cpu->big = true;
+    cpu->setSeg(CS, 0, cpu->seg[CS].value);
+    cpu->thread->process->hasSetSeg[CS] = false;
+    // the other tests rewrite the start of the code segment so often that it is only emulated one instruction at a time
+    U32 code = CODE_ADDRESS + (PAGES_PER_SEG - 1) * K_PAGE_SIZE;
+    cseip = code;
+    cpu->eip.u32 = code;
+    EBX = 0;
+    ESI = code + 2;
+
+    // jmp +4
+    pushCode8(0xeb);
+    pushCode8(0x04);
+
+    // add ebx, 2
+    pushCode8(0x83);
+    pushCode8(0xc3);
+    pushCode8(0x02);
+
+    // ret
+    pushCode8(0xc3);
+
+    // mov ecx, 4
+    pushCode8(0xb9);
+    pushCode32(4);
+
+    // call esi
+    pushCode8(0xff);
+    pushCode8(0xd6);
+
+    // inc eax
+    pushCode8(0x40);
+
+    // dec ecx
+    pushCode8(0x49);
+
+    // jnz -6 (call esi)
+    pushCode8(0x75);
+    pushCode8(0xfa);
+
+    U32 end = cseip;
+    runTestCPU();
+
+    assertTrue(EBX == 8);
+    assertTrue(EAX == 4);
+    assertTrue(ESP == 4096);
+
+    // add ebx, 3
+    memory->writeb(code + 4, 0x03);
+
+    EAX = 0;
+    EBX = 0;
+    cpu->eip.u32 = code;
+    cseip = end;
+    runTestCPU();
+
+    assertTrue(EBX == 12);
+    assertTrue(EAX == 4);
+    assertTrue(ESP == 4096);
+}
+
+// a loop that is entered enough times is translated again as a superblock that runs through its branches and calls
+void testHotChunkSuperblock() {
+    newInstruction(0);
+    cpu->big = true;
+    cpu->setSeg(CS, 0, cpu->seg[CS].value);
+    cpu->thread->process->hasSetSeg[CS] = false;
+    U32 code = CODE_ADDRESS + (PAGES_PER_SEG - 2) * K_PAGE_SIZE;
+    cseip = code;
+    cpu->eip.u32 = code;
+    EBX = 0;
+
+    // mov ecx, 1
+    pushCode8(0xb9);
+    U32 count = cseip;
+    pushCode32(1);
+
+    // jmp +2
+    pushCode8(0xeb);
+    pushCode8(0x02);
+
+    // inc eax
+    pushCode8(0x40);
+
+    // ret
+    pushCode8(0xc3);
+
+    // test cl, 1
+    U32 loop = cseip;
+    pushCode8(0xf6);
+    pushCode8(0xc1);
+    pushCode8(0x01);
+
+    // jz +5
+    pushCode8(0x74);
+    pushCode8(0x05);
+
+    // add ebx, 1
+    pushCode8(0x83);
+    pushCode8(0xc3);
+    pushCode8(0x01);
+
+    // jmp +3
+    pushCode8(0xeb);
+    pushCode8(0x03);
+
+    // add ebx, 16
+    pushCode8(0x83);
+    pushCode8(0xc3);
+    U32 imm = cseip;
+    pushCode8(0x10);
+
+    // call -20 (inc eax)
+    pushCode8(0xe8);
+    pushCode32(0xffffffec);
+
+    // dec ecx
+    pushCode8(0x49);
+
+    // jnz -21 (test cl, 1)
+    pushCode8(0x75);
+    pushCode8(0xeb);
+
+    U32 end = cseip;
+
+    // the loop only runs once, so it isn't hot yet
+    runTestCPU();
+
+    assertTrue(EBX == 1);
+    assertTrue(EAX == 1);
+    assertTrue(ESP == 4096);
+#if defined(BOXEDWINE_BINARY_TRANSLATOR) && defined(BOXEDWINE_X64)
+    std::weak_ptr<BtCodeChunk> replaced = memory->findCodeBlockContaining(loop, 1);
+    assertTrue(!replaced.expired() && !replaced.lock()->superblock);
+
+    // stands in for a thread that is still running the old chunk, it hasn't been to a safe point since it started
+    KThread* other = process->createThread();
+#endif
+
+    // mov ecx, 10
+    memory->writed(count, 10);
+
+    EAX = 0;
+    EBX = 0;
+    cpu->eip.u32 = code;
+    cseip = end;
+    runTestCPU();
+
+    assertTrue(EBX == 85);
+    assertTrue(EAX == 10);
+    assertTrue(ESP == 4096);
+#if defined(BOXEDWINE_BINARY_TRANSLATOR) && defined(BOXEDWINE_X64)
+    CodeBlock chunk = memory->findCodeBlockContaining(loop, 1);
+    assertTrue(chunk && chunk->superblock && chunk->getEip() == loop && chunk->getEipLen() > end - loop);
+
+    // the other thread might still be running the chunk the superblock replaced, so it is kept for now
+    assertTrue(!replaced.expired() && replaced.lock()->retired);
+    process->deleteThread(other);
+#endif
+
+    // the superblock must be invalidated like any other chunk, add ebx, 32
+    memory->writeb(imm, 0x20);
+
+    EAX = 0;
+    EBX = 0;
+    cpu->eip.u32 = code;
+    cseip = end;
+    runTestCPU();
+
+    assertTrue(EBX == 165);
+    assertTrue(EAX == 10);
+    assertTrue(ESP == 4096);
+#if defined(BOXEDWINE_BINARY_TRANSLATOR) && defined(BOXEDWINE_X64)
+    // the loop got hot again, with the other thread gone the chunk the first superblock replaced was freed
+    assertTrue(replaced.expired());
+#endif
+}
+
+#if defined(BOXEDWINE_BINARY_TRANSLATOR) && defined(BOXEDWINE_X64)
+// code translated in one run is loaded from the chunk store in the next one, but only while the guest code is the same
+void testChunkStore() {
+    BString path = B("chunkStoreTest");
+    Fs::deleteNativeDirAndAllFilesInDir(path);
+    static_cast<void>(MKDIR(path.c_str()));
+    KSystem::codeCachePath = path;
+
+    newInstruction(0);
+    cpu->big = true;
+    cpu->setSeg(CS, 0, cpu->seg[CS].value);
+    cpu->thread->process->hasSetSeg[CS] = false;
+    U32 code = CODE_ADDRESS + (PAGES_PER_SEG - 3) * K_PAGE_SIZE;
+    cseip = code;
+    cpu->eip.u32 = code;
+    EBX = 0;
+
+    // mov ecx, 3
+    pushCode8(0xb9);
+    U32 count = cseip;
+    pushCode32(3);
+
+    // add ebx, ecx
+    pushCode8(0x01);
+    pushCode8(0xcb);
+
+    // call +5 (inc eax)
+    pushCode8(0xe8);
+    pushCode32(5);
+
+    // dec ecx
+    pushCode8(0x49);
+
+    // jnz -10 (add ebx, ecx)
+    pushCode8(0x75);
+    pushCode8(0xf6);
+
+    // jmp +2
+    pushCode8(0xeb);
+    pushCode8(0x02);
+
+    // inc eax
+    pushCode8(0x40);
+
+    // ret
+    pushCode8(0xc3);
+
+    U32 end = cseip;
+    runTestCPU();
+
+    assertTrue(EAX == 3);
+    assertTrue(EBX == 6);
+    assertTrue(ESP == 4096);
+
+    // forget what was stored in this run, the next lookup will read it back from the file
+    BtChunkStore::shutdown();
+    U32 loadedChunks = BtChunkStore::loadedChunks;
+
+    // like the start of a new run, nothing is translated yet
+    memory->removeCodeBlock(code, end - code);
+
+    EAX = 0;
+    EBX = 0;
+    cpu->eip.u32 = code;
+    cseip = end;
+    runTestCPU();
+
+    assertTrue(EAX == 3);
+    assertTrue(EBX == 6);
+    assertTrue(ESP == 4096);
+    assertTrue(BtChunkStore::loadedChunks > loadedChunks);
+
+    // mov ecx, 4
+    memory->writed(count, 4);
+
+    EAX = 0;
+    EBX = 0;
+    cpu->eip.u32 = code;
+    cseip = end;
+    runTestCPU();
+
+    assertTrue(EAX == 4);
+    assertTrue(EBX == 10);
+    assertTrue(ESP == 4096);
+
+    // everything this code needs is stored now
+    BtChunkStore::shutdown();
+    loadedChunks = BtChunkStore::loadedChunks;
+    memory->removeCodeBlock(code, end - code);
+    EAX = 0;
+    EBX = 0;
+    cpu->eip.u32 = code;
+    cseip = end;
+    runTestCPU();
+    assertTrue(EAX == 4);
+    assertTrue(EBX == 10);
+    U32 cleanLoads = BtChunkStore::loadedChunks - loadedChunks;
+    assertTrue(cleanLoads > 0);
+
+    // the last record written was for the changed code, a damaged byte at the end of it fails its crc and that code is
+    // translated again instead
+    BtChunkStore::shutdown();
+    FILE* f = fopen(path.stringByApppendingPath("chunks.bin").c_str(), "r+b");
+    assertTrue(f != nullptr);
+    fseek(f, -1, SEEK_END);
+    int last = fgetc(f);
+    fseek(f, -1, SEEK_END);
+    fputc(last ^ 0xff, f);
+    fclose(f);
+
+    loadedChunks = BtChunkStore::loadedChunks;
+    memory->removeCodeBlock(code, end - code);
+    EAX = 0;
+    EBX = 0;
+    cpu->eip.u32 = code;
+    cseip = end;
+    runTestCPU();
+    assertTrue(EAX == 4);
+    assertTrue(EBX == 10);
+    assertTrue(ESP == 4096);
+    assertTrue(BtChunkStore::loadedChunks - loadedChunks < cleanLoads);
+
+    BtChunkStore::shutdown();
+    KSystem::codeCachePath = BString();
+    Fs::deleteNativeDirAndAllFilesInDir(path);
+}
+#endif
+
+#if defined(BOXEDWINE_MULTI_THREADED) && defined(BOXEDWINE_BINARY_TRANSLATOR)
+// the code pushed at CODE_ADDRESS is one LOCK prefixed instruction, it is run with the normal core's version of it
+static void runNormalLockOp() {
+    pushCode8(0xc3); // ret, so that decoding stops after the instruction
+    DecodedBlock* block = NormalCPU::getBlockForInspectionButNotUsed(cpu, CODE_ADDRESS, true);
+    DecodedOp* op = block->op;
+
+    assertTrue(op->lock != 0);
+    cpu->eip.u32 = CODE_ADDRESS;
+    op->pfn(cpu, op);
+    assertTrue(cpu->eip.u32 == CODE_ADDRESS + op->len);
+    block->dealloc(false);
+}
+
+void testNormalLockOps() {
+    // ds is HEAP_ADDRESS
+    U32 address = HEAP_ADDRESS + 0x100;
+    U32 crossing = HEAP_ADDRESS + K_PAGE_SIZE - 2;
+
+    // lock add [address], eax
+    newInstruction(0);
+    memory->writed(address, 5);
+    EAX = 3;
+    pushCode8(0xf0);
+    pushCode8(0x01);
+    pushCode8(0x05);
+    pushCode32(address - HEAP_ADDRESS);
+    runNormalLockOp();
+    assertTrue(memory->readd(address) == 8);
+    assertTrue(!cpu->getCF() && !cpu->getZF());
+
+    // lock xadd [address], ecx
+    newInstruction(0);
+    ECX = 2;
+    pushCode8(0xf0);
+    pushCode8(0x0f);
+    pushCode8(0xc1);
+    pushCode8(0x0d);
+    pushCode32(address - HEAP_ADDRESS);
+    runNormalLockOp();
+    assertTrue(memory->readd(address) == 10);
+    assertTrue(ECX == 8);
+
+    // lock inc dword [address], CF is kept
+    newInstruction(CF);
+    pushCode8(0xf0);
+    pushCode8(0xff);
+    pushCode8(0x05);
+    pushCode32(address - HEAP_ADDRESS);
+    runNormalLockOp();
+    assertTrue(memory->readd(address) == 11);
+    assertTrue(cpu->getCF());
+
+    // lock adc dword [address], 1
+    newInstruction(CF);
+    pushCode8(0xf0);
+    pushCode8(0x83);
+    pushCode8(0x15);
+    pushCode32(address - HEAP_ADDRESS);
+    pushCode8(0x01);
+    runNormalLockOp();
+    assertTrue(memory->readd(address) == 13);
+    assertTrue(!cpu->getCF());
+
+    // lock bts [address], edx, the bit is in the next dword
+    memory->writed(address + 4, 0);
+    for (int i = 0; i < 2; i++) {
+        newInstruction(0);
+        EDX = 33;
+        pushCode8(0xf0);
+        pushCode8(0x0f);
+        pushCode8(0xab);
+        pushCode8(0x15);
+        pushCode32(address - HEAP_ADDRESS);
+        runNormalLockOp();
+        assertTrue(memory->readd(address) == 13);
+        assertTrue(memory->readd(address + 4) == 2);
+        assertTrue(cpu->getCF() == (i == 1));
+    }
+
+    // lock cmpxchg [address], ebx
+    newInstruction(0);
+    EAX = 13;
+    EBX = 20;
+    pushCode8(0xf0);
+    pushCode8(0x0f);
+    pushCode8(0xb1);
+    pushCode8(0x1d);
+    pushCode32(address - HEAP_ADDRESS);
+    runNormalLockOp();
+    assertTrue(memory->readd(address) == 20);
+    assertTrue(cpu->getZF());
+    assertTrue(EAX == 13);
+
+    newInstruction(0);
+    EAX = 13;
+    EBX = 30;
+    pushCode8(0xf0);
+    pushCode8(0x0f);
+    pushCode8(0xb1);
+    pushCode8(0x1d);
+    pushCode32(address - HEAP_ADDRESS);
+    runNormalLockOp();
+    assertTrue(memory->readd(address) == 20);
+    assertTrue(!cpu->getZF());
+    assertTrue(EAX == 20);
+
+    // lock cmpxchg8b [address]
+    newInstruction(0);
+    EAX = 20;
+    EDX = 2;
+    EBX = 1;
+    ECX = 3;
+    pushCode8(0xf0);
+    pushCode8(0x0f);
+    pushCode8(0xc7);
+    pushCode8(0x0d);
+    pushCode32(address - HEAP_ADDRESS);
+    runNormalLockOp();
+    assertTrue(memory->readq(address) == 0x300000001ull);
+    assertTrue(cpu->getZF());
+
+    // lock dec word [address + 1], not aligned
+    newInstruction(0);
+    memory->writed(address, 0x00010000);
+    pushCode8(0x66);
+    pushCode8(0xf0);
+    pushCode8(0xff);
+    pushCode8(0x0d);
+    pushCode32(address + 1 - HEAP_ADDRESS);
+    runNormalLockOp();
+    assertTrue(memory->readd(address) == 0x0000ff00);
+
+    // lock add [crossing], eax, crosses into the next page
+    newInstruction(0);
+    memory->writed(crossing, 0xfffffffe);
+    EAX = 3;
+    pushCode8(0xf0);
+    pushCode8(0x01);
+    pushCode8(0x05);
+    pushCode32(crossing - HEAP_ADDRESS);
+    runNormalLockOp();
+    assertTrue(memory->readd(crossing) == 1);
+    assertTrue(cpu->getCF());
+}
+
+// several threads add to the same dword, half the time with lock inc and half the time with a lock cmpxchg loop, so
+// the two ops have to be atomic with respect to each other.  The unaligned address takes the stripe lock instead.
+static void testNormalLockContention(U32 address) {
+    const U32 numberOfThreads = 8;
+    const U32 numberOfIterationsPerThread = 200000;
+
+    // lock inc dword [address]
+    newInstruction(0);
+    pushCode8(0xf0);
+    pushCode8(0xff);
+    pushCode8(0x05);
+    pushCode32(address - HEAP_ADDRESS);
+    pushCode8(0xc3);
+    DecodedBlock* incBlock = NormalCPU::getBlockForInspectionButNotUsed(cpu, CODE_ADDRESS, true);
+
+    // lock cmpxchg [address], ebx
+    newInstruction(0);
+    pushCode8(0xf0);
+    pushCode8(0x0f);
+    pushCode8(0xb1);
+    pushCode8(0x1d);
+    pushCode32(address - HEAP_ADDRESS);
+    pushCode8(0xc3);
+    DecodedBlock* cmpxchgBlock = NormalCPU::getBlockForInspectionButNotUsed(cpu, CODE_ADDRESS, true);
+
+    memory->writed(address, 0);
+
+    std::vector<KThread*> threads;
+    std::vector<std::thread> hostThreads;
+    for (U32 t = 0; t < numberOfThreads; t++) {
+        KThread* thread = process->createThread();
+        thread->cpu->clone(cpu);
+        thread->cpu->tmpLockAddress = process->alloc(thread, 4);
+        threads.push_back(thread);
+    }
+    for (KThread* thread : threads) {
+        hostThreads.push_back(std::thread([thread, address, incBlock, cmpxchgBlock]() {
+            CPU* c = thread->cpu;
+            for (U32 i = 0; i < numberOfIterationsPerThread; i++) {
+                if (i & 1) {
+                    c->eip.u32 = CODE_ADDRESS;
+                    incBlock->op->pfn(c, incBlock->op);
+                    continue;
+                }
+                do {
+                    c->reg[0].u32 = c->memory->readd(address);
+                    c->reg[3].u32 = c->reg[0].u32 + 1;
+                    c->eip.u32 = CODE_ADDRESS;
+                    cmpxchgBlock->op->pfn(c, cmpxchgBlock->op);
+                } while (!c->getZF());
+            }
+        }));
+    }
+    for (auto& hostThread : hostThreads) {
+        hostThread.join();
+    }
+    for (KThread* thread : threads) {
+        process->deleteThread(thread);
+    }
+    incBlock->dealloc(false);
+    cmpxchgBlock->dealloc(false);
+    assertTrue(memory->readd(address) == numberOfThreads * numberOfIterationsPerThread);
+}
+
+void testNormalLockContention() {
+    testNormalLockContention(HEAP_ADDRESS + 0x200); // host atomic
+    testNormalLockContention(HEAP_ADDRESS + 0x301); // stripe lock
+}
+#endif
+
+// fork should cost about the same no matter where memory is mapped, it should only grow with how much is mapped
+void testForkLatency() {
+    const U32 sizes[] = {1, 16, 64}; // MB
+
+    for (U32 mb : sizes) {
+        KProcessPtr parent = KProcess::create();
+        parent->memory = KMemory::create(parent.get());
+        U32 pageCount = mb << 8;
+        U32 address = parent->memory->mmap(cpu->thread, 0, pageCount << K_PAGE_SHIFT, K_PROT_READ | K_PROT_WRITE, K_MAP_PRIVATE | K_MAP_ANONYMOUS, -1, 0);
+        for (U32 i = 0; i < pageCount; i++) {
+            parent->memory->writed(address + (i << K_PAGE_SHIFT), i);
+        }
+
+        KProcessPtr child = KProcess::create();
+        child->memory = KMemory::create(child.get());
+        U64 startTime = KSystem::getMicroCounter();
+        child->memory->clone(parent->memory, false);
+        U64 time = KSystem::getMicroCounter() - startTime;
+        printf("    fork with %dMB mapped took %dus\n", mb, (U32)time);
+
+        // copy on write should keep the processes apart
+        child->memory->writed(address, 0xFFFFFFFF);
+        assertTrue(parent->memory->readd(address) == 0);
+        assertTrue(child->memory->readd(address) == 0xFFFFFFFF);
+        assertTrue(child->memory->readd(address + ((pageCount - 1) << K_PAGE_SHIFT)) == pageCount - 1);
+    }
+}
+
 void testSelfModifyingFront() {
     // initialize
     newInstruction(0);
@@ -9921,6 +10716,8 @@ void testLockedInc(U32 address) {
     }
     for (U32 i = 0; i < numberOfThreads; i++) {
         joinThread(threads[i]);
+        // a thread left in the process would keep the retired chunks of later tests from being freed
+        process->deleteThread(threads[i]);
     }
     U32 value = memory->readd(cpu->seg[DS].address + address);
     assertTrue(value == numberOfIterationsPerThread * numberOfThreads);
@@ -10402,6 +11199,20 @@ int runCpuTests() {
     run(testFPU0x2dd, "FPU 2dd");
     run(testFPU0x0df, "FPU 0df");
     run(testFPU0x2df, "FPU 2df");
+    setFPUTestHostDouble(true);
+    run(testFPU0x0d8, "FPU 0d8 host double");
+    run(testFPU0x2d8, "FPU 2d8 host double");
+    run(testFPU0x0d9, "FPU 0d9 host double");
+    run(testFPU0x2d9, "FPU 2d9 host double");
+    run(testFPU0x0da, "FPU 0da host double");
+    run(testFPU0x2da, "FPU 2da host double");
+    run(testFPU0x0dd, "FPU 0dd host double");
+    run(testFPU0x2dd, "FPU 2dd host double");
+    run(testFPU0x0df, "FPU 0df host double");
+    run(testFPU0x2df, "FPU 2df host double");
+    run(testFPURounding0x0de, "FPU 0de rounding host double");
+    run(testFPURounding0x2de, "FPU 2de rounding host double");
+    setFPUTestHostDouble(false);
 
     run(testLoopNZ0x0e0, "LoopNZ 0e0");
     run(testLoopNZ0x2e0, "LoopNZ 2e0");
@@ -10858,6 +11669,20 @@ int runCpuTests() {
     run(testLockedInc, "Multi-threaded locked inc");
 #endif
     run(testSplitPageWrite, "Split Page Write");
+    run(testRepStringsAcrossPages, "Rep Strings Across Pages");
+    run(testPtrPool, "Ptr Pool");
+    run(testDamageRegion, "Damage Region");
+    run(testForkLatency, "Fork Latency");
+    run(testFlagsAcrossBranch, "Flags Across Branch");
+    run(testIndirectJumpCache, "Indirect Jump Cache");
+    run(testHotChunkSuperblock, "Hot Chunk Superblock");
+#if defined(BOXEDWINE_BINARY_TRANSLATOR) && defined(BOXEDWINE_X64)
+    run(testChunkStore, "Chunk Store");
+#endif
+#if defined(BOXEDWINE_MULTI_THREADED) && defined(BOXEDWINE_BINARY_TRANSLATOR)
+    run(testNormalLockOps, "Normal Lock Ops");
+    run(testNormalLockContention, "Normal Lock Contention");
+#endif
     printf("%d tests FAILED\n", totalFails);
     KNativeThread::sleep(5000);
     if (totalFails)
@@ -249,9 +249,36 @@ void fild64(U64 value, int index) {
     memory->writeq(HEAP_ADDRESS + 4 * index, value);
 }
 
+// the tests run once at the default 64-bit precision, which uses softfloat, and once at 53-bit precision, which keeps
+// the stack in host doubles
+static bool fpuHostDouble;
+static bool fpuSavedUseF64;
+
+#define FPU_CW_INDEX 64
+
+void setFPUTestHostDouble(bool hostDouble) {
+    if (hostDouble) {
+        fpuSavedUseF64 = KSystem::useF64;
+        KSystem::useF64 = true;
+    } else {
+        KSystem::useF64 = fpuSavedUseF64;
+    }
+    fpuHostDouble = hostDouble;
+}
+
 void fpu_init() {
     pushCode8(0xdb);
     pushCode8(rm(false, 4, 3));
+    if (fpuHostDouble) {
+        // fldcw
+        memory->writew(HEAP_ADDRESS + 4 * FPU_CW_INDEX, 0x27F);
+        pushCode8(0xd9);
+        pushCode8(rm(true, 5, cpu->big ? 5 : 6));
+        if (cpu->big)
+            pushCode32(4 * FPU_CW_INDEX);
+        else
+            pushCode16(4 * FPU_CW_INDEX);
+    }
 }
 
 void doF32Instruction(int op1, int group1, int op2, int group2, float x, float y, float r) {
@@ -2317,6 +2344,58 @@ void testFPUDF() {
     testFILD();
 }
 
+// x op y with the given control word, op is the second byte of a DE xxP st(1), st instruction
+void doFPURounding(U16 cw, U8 op, double x, double y, double r) {
+    newInstruction(0);
+    fpu_init();
+    memory->writew(HEAP_ADDRESS + 4 * (FPU_CW_INDEX + 1), cw);
+    pushCode8(0xd9);
+    pushCode8(rm(true, 5, cpu->big ? 5 : 6));
+    if (cpu->big)
+        pushCode32(4 * (FPU_CW_INDEX + 1));
+    else
+        pushCode16(4 * (FPU_CW_INDEX + 1));
+    fld64(x, 1);
+    fld64(y, 3);
+    pushCode8(0xde);
+    pushCode8(op);
+    writeTopDouble(5, true);
+    runTestCPU();
+    struct FPU_Double result;
+    struct FPU_Double expected;
+    result.l = memory->readq(HEAP_ADDRESS + 4 * 5);
+    expected.d = r;
+    assertTrue(result.l == expected.l);
+}
+
+#define FPU_FADDP 0xc1
+#define FPU_FMULP 0xc9
+#define FPU_FDIVP 0xf9
+
+// control words with all exceptions masked: precision in bits 8-9, rounding in bits 10-11
+#define FPU_CW_24_NEAREST 0x07F
+#define FPU_CW_24_UP 0x87F
+#define FPU_CW_53_DOWN 0x67F
+#define FPU_CW_53_UP 0xA7F
+#define FPU_CW_53_CHOP 0xE7F
+
+void testFPURounding() {
+    double onePlus = 1.0 + ldexp(1.0, -30);
+
+    // 24-bit precision rounds the significand, including values outside of the float range
+    doFPURounding(FPU_CW_24_NEAREST, FPU_FADDP, 1.0, ldexp(1.0, -30), 1.0);
+    doFPURounding(FPU_CW_24_NEAREST, FPU_FMULP, ldexp(onePlus, 200), 1.0, ldexp(1.0, 200));
+    doFPURounding(FPU_CW_24_NEAREST, FPU_FMULP, ldexp(onePlus, -200), 1.0, ldexp(1.0, -200));
+    doFPURounding(FPU_CW_24_NEAREST, FPU_FMULP, -ldexp(onePlus, 200), 1.0, -ldexp(1.0, 200));
+    doFPURounding(FPU_CW_24_UP, FPU_FADDP, 1.0, ldexp(1.0, -30), 1.0 + ldexp(1.0, -23));
+    doFPURounding(FPU_CW_24_UP, FPU_FMULP, ldexp(onePlus, 200), 1.0, ldexp(1.0 + ldexp(1.0, -23), 200));
+
+    // directed rounding at 53-bit precision
+    doFPURounding(FPU_CW_53_UP, FPU_FDIVP, 1.0, 3.0, nextafter(1.0 / 3.0, 1.0));
+    doFPURounding(FPU_CW_53_DOWN, FPU_FDIVP, -1.0, 3.0, nextafter(-1.0 / 3.0, -1.0));
+    doFPURounding(FPU_CW_53_CHOP, FPU_FDIVP, -1.0, 3.0, -1.0 / 3.0);
+    doFPURounding(FPU_CW_53_DOWN, FPU_FDIVP, 1.0, 3.0, 1.0 / 3.0);
+}
 
 void testFPU0x0d8() { cpu->big = false; testFPUD8(); }
 void testFPU0x2d8() { cpu->big = true; testFPUD8(); }
@@ -2328,5 +2407,7 @@ void testFPU0x0dd() { cpu->big = false; testFPUDD(); }
 void testFPU0x2dd() { cpu->big = true; testFPUDD(); }
 void testFPU0x0df() { cpu->big = false; testFPUDF(); }
 void testFPU0x2df() { cpu->big = true; testFPUDF(); }
+void testFPURounding0x0de() { cpu->big = false; testFPURounding(); }
+void testFPURounding0x2de() { cpu->big = true; testFPURounding(); }
 
 #endif
\ No newline at end of file
@@ -29,5 +29,9 @@ void testFPU0x0dd();
 void testFPU0x2dd();
 void testFPU0x0df();
 void testFPU0x2df();
+void testFPURounding0x0de();
+void testFPURounding0x2de();
+
+void setFPUTestHostDouble(bool hostDouble);
 
 #endif
\ No newline at end of file
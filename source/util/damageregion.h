@@ -0,0 +1,96 @@
+/*
+ *  Copyright (C) 2012-2025  The BoxedWine Team
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef __DAMAGE_REGION_H__
+#define __DAMAGE_REGION_H__
+
+// The parts of a drawable that changed since it was last put on the screen.  Rectangles that overlap or touch are
+// merged, and once there are more than MAX_RECTS the whole region becomes its bounding box, so that a lot of small
+// updates don't turn into a lot of small texture uploads.
+class DamageRegion {
+public:
+	struct Rect {
+		S32 left;
+		S32 top;
+		S32 right; // exclusive
+		S32 bottom; // exclusive
+
+		U32 width() const { return (U32)(right - left); }
+		U32 height() const { return (U32)(bottom - top); }
+	};
+
+	static constexpr U32 MAX_RECTS = 16;
+
+	// clipped to maxWidth x maxHeight
+	void add(S32 x, S32 y, U32 width, U32 height, U32 maxWidth, U32 maxHeight) {
+		Rect r;
+		r.left = std::max(x, 0);
+		r.top = std::max(y, 0);
+		r.right = (S32)std::min((S64)x + width, (S64)maxWidth);
+		r.bottom = (S32)std::min((S64)y + height, (S64)maxHeight);
+		if (r.left >= r.right || r.top >= r.bottom) {
+			return;
+		}
+		// a merged rect can now touch ones that it didn't before
+		bool merged = true;
+		while (merged) {
+			merged = false;
+			for (U32 i = 0; i < (U32)rects.size(); i++) {
+				Rect& o = rects[i];
+				if (r.left <= o.right && o.left <= r.right && r.top <= o.bottom && o.top <= r.bottom) {
+					r.left = std::min(r.left, o.left);
+					r.top = std::min(r.top, o.top);
+					r.right = std::max(r.right, o.right);
+					r.bottom = std::max(r.bottom, o.bottom);
+					rects.erase(rects.begin() + i);
+					merged = true;
+					break;
+				}
+			}
+		}
+		rects.push_back(r);
+		if (rects.size() > MAX_RECTS) {
+			Rect b = bounds();
+			rects.clear();
+			rects.push_back(b);
+		}
+	}
+
+	void addAll(U32 width, U32 height) {
+		rects.clear();
+		add(0, 0, width, height, width, height);
+	}
+
+	Rect bounds() const {
+		Rect result = rects.front();
+		for (auto& r : rects) {
+			result.left = std::min(result.left, r.left);
+			result.top = std::min(result.top, r.top);
+			result.right = std::max(result.right, r.right);
+			result.bottom = std::max(result.bottom, r.bottom);
+		}
+		return result;
+	}
+
+	bool isEmpty() const { return rects.empty(); }
+	void clear() { rects.clear(); }
+
+	std::vector<Rect> rects;
+};
+
+#endif
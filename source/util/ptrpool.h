@@ -20,36 +20,81 @@
 
 #include <type_traits>
 
+// When needsMutex is set each thread keeps a magazine of free objects, so a get or put only locks the shared free list
+// when the magazine is empty or full and then moves half a magazine at a time.  There is one magazine per thread for
+// each PtrPool type, pools are expected to be a single static per type.
 template<typename T, bool needsMutex = true>
 class PtrPool {
 private:
-    std::queue<T*> queue;
+    static constexpr U32 MAGAZINE_SIZE = 64;
+
+    struct Magazine {
+        PtrPool* pool = nullptr;
+        U32 generation = 0;
+        U32 count = 0;
+        T* items[MAGAZINE_SIZE];
+
+        // a thread that exits gives what it has back
+        ~Magazine() {
+            if (pool && count) {
+                pool->returnMagazine(*this, count);
+            }
+        }
+    };
+
+    std::vector<T*> freeList;
     std::vector<T*> allocated;
     BOXEDWINE_MUTEX mutex;
     int blockSize;
+    std::atomic<U32> generation = 0;
 
+    // stats
+    std::atomic<U32> allocatedCount = 0;
+    std::atomic<U32> freeCount = 0;
+    std::atomic<U32> sharedLockCount = 0;
+    std::atomic<U32> contendedCount = 0;
+
+    void lockShared() {
+        if constexpr (needsMutex) {
+            if (!BOXEDWINE_MUTEX_TRY_LOCK(mutex)) {
+                contendedCount++;
+                BOXEDWINE_MUTEX_LOCK(mutex);
+            }
+            sharedLockCount++;
+        }
+    }
+
+    void unlockShared() {
+        if constexpr (needsMutex) {
+            BOXEDWINE_MUTEX_UNLOCK(mutex);
+        }
+    }
+
+    // the caller holds mutex
     T* internalGet() {
-        if (!queue.empty()) {
-            T* newData = queue.front();
-            queue.pop();
+        if (!freeList.empty()) {
+            T* newData = freeList.back();
+            freeList.pop_back();
+            freeCount--;
             return newData;
         }
         if (blockSize == 0) {
             return nullptr;
         }
         T* t = new T[blockSize];
-        for (int i = 1; i < blockSize; i++) {
-            queue.push(&t[i]);
+        for (int i = blockSize - 1; i > 0; i--) {
+            freeList.push_back(&t[i]);
         }
         allocated.push_back(t);
+        allocatedCount += blockSize;
+        freeCount += blockSize - 1;
         return &t[0];
     }
 
-    inline void internalPut(T* obj) {
+    inline void reset(T* obj) {
         if constexpr (!std::is_integral<T>::value) {
             obj->reset();
         }
-        queue.push(obj);
     }
 
     void internalDeleteAll() {
@@ -57,7 +102,47 @@ private:
             delete[] t;
         }
         allocated.clear();
-        queue = {};
+        freeList = {};
+        allocatedCount = 0;
+        freeCount = 0;
+        // magazines that other threads still have now point to deleted objects
+        generation++;
+    }
+
+    Magazine& getMagazine() {
+        static thread_local Magazine magazine;
+        if (magazine.pool != this || magazine.generation != generation) {
+            magazine.pool = this;
+            magazine.generation = generation;
+            magazine.count = 0;
+        }
+        return magazine;
+    }
+
+    // moves up to half a magazine from the shared free list, returns one object for the caller
+    T* fillMagazine(Magazine& magazine) {
+        lockShared();
+        T* result = internalGet();
+        while (result && magazine.count < MAGAZINE_SIZE / 2 && !freeList.empty()) {
+            magazine.items[magazine.count++] = freeList.back();
+            freeList.pop_back();
+            freeCount--;
+        }
+        unlockShared();
+        return result;
+    }
+
+    void returnMagazine(Magazine& magazine, U32 count) {
+        lockShared();
+        if (magazine.generation == generation) {
+            for (U32 i = 0; i < count; i++) {
+                freeList.push_back(magazine.items[--magazine.count]);
+            }
+            freeCount += count;
+        } else {
+            magazine.count = 0;
+        }
+        unlockShared();
     }
 public:
     PtrPool(int blockSize=10000) : blockSize(blockSize) {}
@@ -67,8 +152,11 @@ public:
     /// Return an object from the pool.
     T* get() {
         if constexpr (needsMutex) {
-            BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(mutex);
-            return internalGet();
+            Magazine& magazine = getMagazine();
+            if (magazine.count) {
+                return magazine.items[--magazine.count];
+            }
+            return fillMagazine(magazine);
         } else {
             return internalGet();
         }
@@ -76,12 +164,17 @@ public:
 
     /// Mark the given object for reuse in the future.
     inline void put(T* obj) {
+        reset(obj);
         if constexpr (needsMutex) {
-            BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(mutex);
-            internalPut(obj);
+            Magazine& magazine = getMagazine();
+            if (magazine.count == MAGAZINE_SIZE) {
+                returnMagazine(magazine, MAGAZINE_SIZE / 2);
+            }
+            magazine.items[magazine.count++] = obj;
         } else {
-            internalPut(obj);
-        }        
+            freeList.push_back(obj);
+            freeCount++;
+        }
     }
 
     void deleteAll() {
@@ -92,5 +185,19 @@ public:
             internalDeleteAll();
         }
     }
-};
 
+    /// Objects allocated, objects in use (including the ones sitting in thread magazines), how many times the shared
+    /// free list was locked and how many of those had to wait for another thread.
+    BString getStats(const char* name) {
+        BString result = BString::copy(name);
+        result.append(" ");
+        result.append(allocatedCount.load());
+        result.append("/");
+        result.append(allocatedCount.load() - freeCount.load());
+        result.append(" locks ");
+        result.append(sharedLockCount.load());
+        result.append("/");
+        result.append(contendedCount.load());
+        return result;
+    }
+};
@@ -57,37 +57,24 @@ bool BoxedWineCondition::tryLock() {
 }
 
 void BoxedWineCondition::signal() {
-    if (parentCount) {
-        for (int i = 0; i < MAX_PARENTS; i++) {
-            std::shared_ptr<BoxedWineCondition> parent;
-            
-            {
-                const std::lock_guard<std::mutex> lock(parentsMutex);
-                parent = parents[i].lock();
-            }
-            if (parent) {
-                BOXEDWINE_CRITICAL_SECTION_WITH_CONDITION(parent);
-                parent->signal();
-                break;
-            }
-        }
+    if (onSignal) {
+        onSignal();
+    }
+    // every parent is a different waiter (poll, select, an epoll entry), so each one needs to hear about it
+    for (auto& parent : getParents()) {
+        BOXEDWINE_CRITICAL_SECTION_WITH_CONDITION(parent);
+        parent->signal();
     }
     this->c.notify_one();
 }
 
 void BoxedWineCondition::signalAll() {
-    if (parentCount) {
-        for (int i = 0; i < MAX_PARENTS; i++) {
-            std::shared_ptr<BoxedWineCondition> parent;
-            {
-                const std::lock_guard<std::mutex> lock(parentsMutex);
-                parent = parents[i].lock();
-            }
-            if (parent) {
-                BOXEDWINE_CRITICAL_SECTION_WITH_CONDITION(parent);
-                parent->signalAll();
-            }
-        }
+    if (onSignal) {
+        onSignal();
+    }
+    for (auto& parent : getParents()) {
+        BOXEDWINE_CRITICAL_SECTION_WITH_CONDITION(parent);
+        parent->signalAll();
     }
     this->c.notify_all();
 }
@@ -101,18 +88,9 @@ void BoxedWineCondition::wait(std::unique_lock<std::mutex>& lock) {
     if (thread) {
         thread->waitingCond = nullptr;
     }
-    if (parentCount) {
-        for (int i = 0; i < MAX_PARENTS; i++) {
-            std::shared_ptr<BoxedWineCondition> parent;
-            {
-                const std::lock_guard<std::mutex> lock(parentsMutex);
-                parent = parents[i].lock();
-            }
-            if (parent) {
-                BOXEDWINE_CRITICAL_SECTION_WITH_CONDITION(parent);
-                parent->signalAll();
-            }
-        }
+    for (auto& parent : getParents()) {
+        BOXEDWINE_CRITICAL_SECTION_WITH_CONDITION(parent);
+        parent->signalAll();
     }
 }
 
@@ -125,18 +103,9 @@ void BoxedWineCondition::waitWithTimeout(std::unique_lock<std::mutex>& lock, U32
     if (thread) {
         thread->waitingCond = nullptr;
     }    
-    if (parentCount) {
-        for (int i = 0; i < MAX_PARENTS; i++) {
-            std::shared_ptr<BoxedWineCondition> parent;
-            {
-                const std::lock_guard<std::mutex> lock(parentsMutex);
-                parent = parents[i].lock();
-            }
-            if (parent) {
-                BOXEDWINE_CRITICAL_SECTION_WITH_CONDITION(parent);
-                parent->signalAll();
-            }
-        }
+    for (auto& parent : getParents()) {
+        BOXEDWINE_CRITICAL_SECTION_WITH_CONDITION(parent);
+        parent->signalAll();
     }
 }
 
@@ -145,40 +114,53 @@ void BoxedWineCondition::unlock() {
     this->m.unlock();
 }
 
+std::vector<std::shared_ptr<BoxedWineCondition>> BoxedWineCondition::getParents() {
+    std::vector<std::shared_ptr<BoxedWineCondition>> result;
+    const std::lock_guard<std::mutex> lock(parentsMutex);
+    for (auto& p : parents) {
+        std::shared_ptr<BoxedWineCondition> parent = p.lock();
+        if (parent) {
+            result.push_back(parent);
+        }
+    }
+    return result;
+}
+
 void BoxedWineCondition::addParentCondition(const std::shared_ptr<BoxedWineCondition>& parent) {
     const std::lock_guard<std::mutex> lock(parentsMutex);
-    if (parentCount) {
-        for (int i = 0; i < MAX_PARENTS; i++) {
-            std::shared_ptr<BoxedWineCondition> p = parents[i].lock();
-            if (p == parent) {
-                return;
-            }
+    for (auto& p : parents) {
+        if (p.lock() == parent) {
+            return;
         }
     }
-    for (int i = 0; i < MAX_PARENTS;i++) {
-        if (parents[i].expired()) {
-            parents[i] = parent;
-            parentCount++;
+    // an epoll set keeps its slot for as long as the fd is registered, so there is no fixed limit
+    for (auto& p : parents) {
+        if (p.expired()) {
+            p = parent;
             return;
         }
     }
-    kpanic("BoxedWineCondition::addParentCondition ran out of parent slots");
+    parents.push_back(parent);
 }
 
 void BoxedWineCondition::removeParentCondition(const std::shared_ptr<BoxedWineCondition>& parent) {
     const std::lock_guard<std::mutex> lock(parentsMutex);
-    for (int i = 0; i < MAX_PARENTS; i++) {
-        std::shared_ptr<BoxedWineCondition> p = parents[i].lock();
-        if (p == parent) {
-            parents[i].reset();
-            parentCount--;
+    for (auto& p : parents) {
+        if (p.lock() == parent) {
+            p.reset();
         }
     }
 }
 
 U32 BoxedWineCondition::parentsCount() {
     const std::lock_guard<std::mutex> lock(parentsMutex);
-    return parentCount;
+    U32 result = 0;
+    for (auto& p : parents) {
+        if (!p.expired()) {
+            result++;
+        }
+    }
+    return result;
 }
 
 #else 
@@ -216,10 +198,13 @@ void BoxedWineCondition::signalThread(bool all) {
 }
 
 void BoxedWineCondition::signal() {
+    if (onSignal) {
+        onSignal();
+    }
     this->signalThread(false);
 
     if (parentCount) {
-        for (int i = 0; i < MAX_PARENTS; i++) {
+        for (U32 i = 0; i < (U32)parents.size(); i++) {
             std::shared_ptr<BoxedWineCondition> parent = parents[i].lock();
             if (parent) {
                 parent->signal();
@@ -229,10 +214,13 @@ void BoxedWineCondition::signal() {
 }
 
 void BoxedWineCondition::signalAll() {
+    if (onSignal) {
+        onSignal();
+    }
     this->signalThread(true);
 
     if (parentCount) {
-        for (int i = 0; i < MAX_PARENTS; i++) {
+        for (U32 i = 0; i < (U32)parents.size(); i++) {
             std::shared_ptr<BoxedWineCondition> parent = parents[i].lock();
             if (parent) {
                 parent->signalAll();
@@ -250,7 +238,7 @@ U32 BoxedWineCondition::wait() {
 
 U32 BoxedWineCondition::waitWithTimeout(U32 ms) {
     KThread* thread = KThread::currentThread();
-    thread->condTimer.millies = ms + KSystem::getMilliesSinceStart();
+    thread->condTimer.micros = (U64)ms * 1000 + KSystem::getMicroCounter();
     thread->condTimer.cond = this;
     addTimer(&thread->condTimer);
     this->waitingThreads.addToBack(&KThread::currentThread()->waitThreadNode);
@@ -265,25 +253,26 @@ U32 BoxedWineCondition::waitCount() {
 
 void BoxedWineCondition::addParentCondition(const std::shared_ptr<BoxedWineCondition>& parent) {
     if (parentCount) {
-        for (int i = 0; i < MAX_PARENTS; i++) {
+        for (U32 i = 0; i < (U32)parents.size(); i++) {
             std::shared_ptr<BoxedWineCondition> p = parents[i].lock();
             if (p == parent) {
                 return;
             }
         }
     }
-    for (int i = 0; i < MAX_PARENTS; i++) {
+    // an epoll set keeps its slot for as long as the fd is registered, so there is no fixed limit
+    parentCount++;
+    for (U32 i = 0; i < (U32)parents.size(); i++) {
         if (parents[i].expired()) {
             parents[i] = parent;
-            parentCount++;
             return;
         }
     }
-    kpanic("BoxedWineCondition::addParentCondition ran out of parent slots");
+    parents.push_back(parent);
 }
 
 void BoxedWineCondition::removeParentCondition(const std::shared_ptr<BoxedWineCondition>& parent) {
-    for (int i = 0; i < MAX_PARENTS; i++) {
+    for (U32 i = 0; i < (U32)parents.size(); i++) {
         std::shared_ptr<BoxedWineCondition> p = parents[i].lock();
         if (p == parent) {
             parents[i].reset();
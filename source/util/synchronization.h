@@ -47,15 +47,16 @@ public:
     U32 parentsCount();
     U32 waitCount() {return parentsCount();}
     const BString name;
+    std::function<void(void)> onSignal; // called by signal and signalAll before any waiters or parents are woken
 
     std::mutex m;
     std::condition_variable c;
     U32 lockOwner = 0;
 
 private:
-#define MAX_PARENTS 2
-    U32 parentCount = 0;
-    std::weak_ptr<BoxedWineCondition> parents[MAX_PARENTS];
+    std::vector<std::shared_ptr<BoxedWineCondition>> getParents();
+
+    std::vector<std::weak_ptr<BoxedWineCondition>> parents;
     std::mutex parentsMutex;
 };
 
@@ -125,12 +126,12 @@ public:
     void removeParentCondition(const std::shared_ptr<BoxedWineCondition>& parent);
     U32 parentsCount();    
     const BString name;
+    std::function<void(void)> onSignal; // called by signal and signalAll before any waiters or parents are woken
 private:
     KList<KThread*> waitingThreads;    
 
-#define MAX_PARENTS 2
     U32 parentCount = 0;
-    std::weak_ptr<BoxedWineCondition> parents[MAX_PARENTS];
+    std::vector<std::weak_ptr<BoxedWineCondition>> parents;
 
     friend BoxedWineConditionTimer;
     void signalThread(bool all);
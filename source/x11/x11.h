@@ -754,6 +754,35 @@ struct XGenericEventCookie {
 	U32 data;
 };
 
+/***************************************************************
+ *
+ * MIT-SHM
+ */
+
+#define ShmCompletion 0
+#define X_ShmPutImage 3
+
+struct XShmCompletionEvent {
+	S32 type;		/* of event */
+	U32 serial;	/* # of last request processed by server */
+	Bool send_event;	/* true if this came from a SendEvent request */
+	U32 display;	/* Display the event was read from */
+	Drawable drawable;	/* drawable of request */
+	S32 major_code;	/* ShmReqCode */
+	S32 minor_code;	/* X_ShmPutImage */
+	U32 shmseg;	/* the ShmSeg used in the request */
+	U32 offset;	/* the offset into ShmSeg used in the request */
+};
+
+struct XShmSegmentInfo {
+	U32 shmseg;	/* resource id */
+	S32 shmid;	/* kernel id */
+	U32 shmaddr;	/* address in client */
+	Bool readOnly;	/* how the server should attach it */
+};
+
+static_assert(sizeof(XShmSegmentInfo) == 16, "emulation expects sizeof(XShmSegmentInfo) to be 16");
+
 /*
  * this union is defined so Xlib can always use the same sized
  * event structure internally, to avoid memory fragmentation.
@@ -793,6 +822,7 @@ union XEvent {
 	XKeymapEvent xkeymap;
 	XGenericEvent xgeneric;
 	XGenericEventCookie xcookie;
+	XShmCompletionEvent xshmcompletion;
 	U32 pad[24];
 };
 
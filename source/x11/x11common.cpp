@@ -2465,6 +2465,11 @@ static void x11_QueryExtension(CPU* cpu) {
         cpu->memory->writed(ARG3, XServer::getServer()->getExtensionGLX());
         cpu->memory->writed(ARG4, 0);
         cpu->memory->writed(ARG5, 0);
+    } else if (name == "MIT-SHM") {
+        cpu->memory->writed(ARG3, XServer::getServer()->getExtensionShm());
+        cpu->memory->writed(ARG4, SHM_EVENT_BASE);
+        cpu->memory->writed(ARG5, 0);
+        EAX = True;
     }  else {
         EAX = False;
     }
@@ -2482,21 +2487,95 @@ static void x11_ShapeOffsetShape(CPU* cpu) {
     kpanic("x11_ShapeOffsetShape");
 }
 
+// Bool XShmAttach(Display* dpy, XShmSegmentInfo* shminfo)
 static void x11_ShmAttach(CPU* cpu) {
-    kpanic("x11_ShmAttach");
+    KThread* thread = cpu->thread;
+    KMemory* memory = cpu->memory;
+    std::shared_ptr<SHM> shm = KSystem::getSHM(thread, X11_READD(XShmSegmentInfo, ARG2, shmid));
+    if (!shm) {
+        EAX = False;
+        return;
+    }
+    U32 shmseg = XServer::getServer()->shmAttach(shm, X11_READD(XShmSegmentInfo, ARG2, shmaddr), thread->process->id);
+    X11_WRITED(XShmSegmentInfo, ARG2, shmseg, shmseg);
+    EAX = True;
 }
 
 // XImage* XShmCreateImage(Display* dpy, Visual* visual, unsigned int depth, int format, char* data, XShmSegmentInfo* shminfo, unsigned int width, unsigned int height)
 static void x11_ShmCreateImage(CPU* cpu) {
-    kpanic("x11_ShmCreateImage");
+    KThread* thread = cpu->thread;
+    KMemory* memory = cpu->memory;
+    Visual visual = {};
+    if (ARG2) {
+        visual.read(memory, ARG2);
+    }
+    U32 depth = ARG3;
+    U32 format = ARG4; // winex11: will always be ZPixmap
+    U32 data = ARG5;
+    U32 shminfo = ARG6;
+    U32 width = ARG7;
+    U32 height = ARG8;
+    U32 bits_per_pixel = depth == 24 ? 32 : depth;
+    U32 bytes_per_line = (bits_per_pixel * width + 31) / 32 * 4;
+
+    U32 image = thread->process->alloc(thread, sizeof(XImage));
+    XImage::set(memory, image, width, height, 0, format, data, 32, depth, bytes_per_line, bits_per_pixel, visual.red_mask, visual.green_mask, visual.blue_mask);
+    X11_WRITED(XImage, image, obdata, shminfo);
+    EAX = image;
+}
+
+// int XShmDestroyImage(XImage* ximage), the data is in the shared memory segment and isn't owned by the image
+static void x11_ShmDestroyImage(CPU* cpu) {
+    cpu->thread->process->free(ARG1);
+    EAX = Success;
 }
 
+// Bool XShmDetach(Display* dpy, XShmSegmentInfo* shminfo)
 static void x11_ShmDetach(CPU* cpu) {
-    kpanic("x11_ShmDetach");
+    KMemory* memory = cpu->memory;
+    EAX = XServer::getServer()->shmDetach(X11_READD(XShmSegmentInfo, ARG2, shmseg)) ? True : False;
 }
 
+// Bool XShmPutImage(Display* dpy, Drawable d, GC gc, XImage* image, int src_x, int src_y, int dst_x, int dst_y, unsigned int src_width, unsigned int src_height, Bool send_event)
 static void x11_ShmPutImage(CPU* cpu) {
-    kpanic("x11_ShmPutImage");
+    XServer* server = XServer::getServer();
+    KMemory* memory = cpu->memory;
+    XDrawablePtr d = server->getDrawable(ARG2);
+    XGCPtr gc = server->getGC(ARG3);
+    if (!d || !gc) {
+        EAX = False;
+        return;
+    }
+    XImage image;
+    XImage::read(memory, ARG4, &image);
+    U32 shmseg = X11_READD(XShmSegmentInfo, image.obdata, shmseg);
+    XShmSegmentPtr segment = server->getShmSegment(shmseg);
+    if (!segment || image.data < segment->address) {
+        EAX = False;
+        return;
+    }
+    U32 offset = image.data - segment->address;
+    if (d->copyShmImageData(gc, segment->shm, offset, image.bytes_per_line, image.bits_per_pixel, ARG5, ARG6, ARG7, ARG8, ARG9, ARG10) != Success) {
+        EAX = False;
+        return;
+    }
+    if (ARG11) {
+        DisplayDataPtr data = server->getDisplayDataByAddressOfDisplay(memory, ARG1);
+        if (data) {
+            XEvent event = {};
+            event.xshmcompletion.type = SHM_EVENT_BASE + ShmCompletion;
+            event.xshmcompletion.serial = data->getNextEventSerial();
+            event.xshmcompletion.send_event = False;
+            event.xshmcompletion.display = data->displayAddress;
+            event.xshmcompletion.drawable = ARG2;
+            event.xshmcompletion.major_code = server->getExtensionShm();
+            event.xshmcompletion.minor_code = X_ShmPutImage;
+            event.xshmcompletion.shmseg = shmseg;
+            event.xshmcompletion.offset = offset;
+            data->putEvent(event);
+        }
+    }
+    EAX = True;
 }
 
 static void x11_WindowEvent(CPU* cpu) {
@@ -3120,6 +3199,7 @@ void x11_init() {
     int9BCallback[X11_SHM_ATTACH] = x11_ShmAttach;
     int9BCallback[X11_SHM_CREATE_IMAGE] = x11_ShmCreateImage;
     int9BCallback[X11_SHM_DETACH] = x11_ShmDetach;
+    int9BCallback[X11_SHM_DESTROY_IMAGE] = x11_ShmDestroyImage;
     int9BCallback[X11_SHM_PUT_IMAGE] = x11_ShmPutImage;
     int9BCallback[X11_STORE_COLOR] = x11_StoreColor;
     int9BCallback[X11_WINDOW_EVENT] = x11_WindowEvent;
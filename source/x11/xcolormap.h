@@ -43,6 +43,7 @@ public:
 	XColorMapColor colors[MAX_COLORMAP_SIZE] = {};
 	bool dirty = false;
 	U32 nativePixels[MAX_COLORMAP_SIZE];
+	U32 generation = 0; // changes each time nativePixels is rebuilt
 
 	void buildCache();
 };
@@ -133,7 +133,70 @@ int XDrawable::copyImageData(KThread* thread, const std::shared_ptr<XGC>& gc, U3
 			dst += this->bytes_per_line;
 		}
 	}
-	setDirty();
+	setDirty(dst_x, dst_y, width, height);
+	return Success;
+}
+
+// returns false if len bytes at offset are not all in the segment
+static bool readShm(const std::shared_ptr<SHM>& shm, U32 offset, U8* dst, U32 len) {
+	if ((U64)offset + len > shm->pages.size() * K_PAGE_SIZE) {
+		return false;
+	}
+	while (len) {
+		U32 pageOffset = offset & K_PAGE_MASK;
+		U32 todo = std::min(len, K_PAGE_SIZE - pageOffset);
+		memcpy(dst, ramPageGet(shm->pages[offset >> K_PAGE_SHIFT]) + pageOffset, todo);
+		dst += todo;
+		offset += todo;
+		len -= todo;
+	}
+	return true;
+}
+
+int XDrawable::copyShmImageData(const std::shared_ptr<XGC>& gc, const std::shared_ptr<SHM>& shm, U32 data, U32 bytes_per_line, S32 bits_per_pixel, S32 src_x, S32 src_y, S32 dst_x, S32 dst_y, U32 width, U32 height) {
+	if (bits_per_pixel != this->visual->bits_per_rgb) {
+		return BadMatch;
+	}
+	BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(mutex);
+	U32 src = data + bytes_per_line * src_y + (bits_per_pixel * src_x + 7) / 8;
+	U8* dst = this->data + this->bytes_per_line * dst_y + (bits_per_pixel * dst_x + 7) / 8;
+	if (dst_x + width > w) {
+		if ((S32)w < dst_x) {
+			return Success;
+		}
+		width = w - dst_x;
+	}
+	if (dst_y + (S32)height > (S32)h) {
+		if ((S32)h < dst_y) {
+			return Success;
+		}
+		height = h - dst_y;
+	}
+	U32 copyPerLine = (bits_per_pixel * width + 7) / 8;
+
+	if (!gc || gc->values.function == GXcopy) {
+		for (U32 y = 0; y < height; y++) {
+			if (!readShm(shm, src, dst, copyPerLine)) {
+				return BadValue;
+			}
+			src += bytes_per_line;
+			dst += this->bytes_per_line;
+		}
+	} else if (gc->values.function == GXxor && bits_per_pixel == 32) {
+		std::vector<U32> line(width);
+		for (U32 y = 0; y < height; y++) {
+			if (!readShm(shm, src, (U8*)line.data(), copyPerLine)) {
+				return BadValue;
+			}
+			U32* dstPixel = (U32*)dst;
+			for (U32 x = 0; x < width; x++) {
+				dstPixel[x] ^= line[x];
+			}
+			src += bytes_per_line;
+			dst += this->bytes_per_line;
+		}
+	}
+	setDirty(dst_x, dst_y, width, height);
 	return Success;
 }
 
@@ -166,7 +229,7 @@ int XDrawable::copy(KThread* thread, const std::shared_ptr<XGC>& gc, const std::
 		src += srcDrawable->bytes_per_line;
 		dst += this->bytes_per_line;
 	}
-	setDirty();
+	setDirty(dstX, dstY, width, height);
 	return Success;
 }
 
@@ -235,7 +298,7 @@ int XDrawable::fillRectangle(KThread* thread, const std::shared_ptr<XGC>& gc, S3
 	} else {
         kwarn_fmt("XDrawable::fillRectangle only %d-bit not handled", visual->bits_per_rgb);
 	}
-	setDirty();
+	setDirty(x, y, width, height);
 	return Success;
 }
 
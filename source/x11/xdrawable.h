@@ -19,6 +19,8 @@
 #ifndef __X_DRAWABLE_H__
 #define __X_DRAWABLE_H__
 
+#include "../util/damageregion.h"
+
 class XGC;
 
 class XDrawable {
@@ -36,6 +38,8 @@ public:
 	int copy(KThread* thread, const std::shared_ptr<XGC>& gc, const std::shared_ptr<XDrawable>& src, S32 srcX, S32 srcY, U32 width, U32 height, S32 dstX, S32 dstY);
 
 	int copyImageData(KThread* thread, const std::shared_ptr<XGC>& gc, U32 data, U32 bytes_per_line, S32 bits_per_pixel, S32 src_x, S32 src_y, S32 dst_x, S32 dst_y, U32 width, U32 height);
+	// data is the offset of the image in the segment, it is read straight from the segment's pages
+	int copyShmImageData(const std::shared_ptr<XGC>& gc, const std::shared_ptr<SHM>& shm, U32 data, U32 bytes_per_line, S32 bits_per_pixel, S32 src_x, S32 src_y, S32 dst_x, S32 dst_y, U32 width, U32 height);
 
 	U32 getImage(KThread* thread, S32 x, S32 y, U32 width, U32 height, U32 planeMask, U32 format, U32 redMask, U32 greenMask, U32 blueMask);
 
@@ -53,6 +57,8 @@ public:
 	void unlockData();
 
 	virtual void setDirty() {};
+	// only this part of the drawable changed
+	virtual void setDirty(S32 x, S32 y, U32 width, U32 height) {};
 	bool isDirty = false;
 	const bool isWindow;
 	bool isOpenGL = false;
@@ -67,6 +73,9 @@ protected:
 	U32 size;
 	U32 bytes_per_line;
 
+	// what changed since the last time this was drawn, guarded by lockData
+	DamageRegion damage;
+
 private:
 	BOXEDWINE_MUTEX mutex;
 	U32 w;
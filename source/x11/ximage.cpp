@@ -60,4 +60,5 @@ void XImage::read(KMemory* memory, U32 address, XImage* image) {
 	image->red_mask = memory->readd(address + 48);
 	image->green_mask = memory->readd(address + 52);
 	image->blue_mask = memory->readd(address + 56);
+	image->obdata = memory->readd(address + 60);
 }
\ No newline at end of file
@@ -65,6 +65,7 @@ XServer::XServer()
 	visual = visualsByDepth.get(depths.front())->front();
 	extensionXinput2 = internAtom(B("XInputExtension"), false);
 	extensionGLX = internAtom(B("GLX"), false);
+	extensionShm = internAtom(B("MIT-SHM"), false);
 }
 
 VisualPtr XServer::addVisual(U32 redMask, U32 greenMask, U32 blueMask, U32 depth, U32 bitsPerPixel, U32 pixelFormatIndex) {
@@ -454,6 +455,27 @@ XDrawablePtr XServer::getDrawable(U32 xid) {
 	return getWindow(xid);
 }
 
+U32 XServer::shmAttach(const std::shared_ptr<SHM>& shm, U32 address, U32 pid) {
+	XShmSegmentPtr segment = std::make_shared<XShmSegment>(getNextId(), shm, address, pid);
+	BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(shmSegmentsMutex);
+	shmSegments.set(segment->id, segment);
+	return segment->id;
+}
+
+XShmSegmentPtr XServer::getShmSegment(U32 shmseg) {
+	BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(shmSegmentsMutex);
+	return shmSegments.get(shmseg);
+}
+
+bool XServer::shmDetach(U32 shmseg) {
+	BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(shmSegmentsMutex);
+	if (!shmSegments.contains(shmseg)) {
+		return false;
+	}
+	shmSegments.remove(shmseg);
+	return true;
+}
+
 void XServer::addCursor(const XCursorPtr& cursor) {
 	BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(cursorsMutex);
 	cursors.set(cursor->id, cursor);
@@ -674,16 +696,30 @@ void XServer::changeScreen(U32 width, U32 height) {
 }
 
 void XServer::processExit(U32 pid) {
-	BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(displayMutex);
-	std::vector<DisplayDataPtr> processDisplays;
+	{
+		BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(displayMutex);
+		std::vector<DisplayDataPtr> processDisplays;
+
+		for (auto& display : displays) {
+			if (display.value->processId == pid) {
+				processDisplays.push_back(display.value);
+			}
+		}
+		for (auto& display : processDisplays) {
+			displays.remove(display->displayId);
+		}
+	}
+
+	BOXEDWINE_CRITICAL_SECTION_WITH_MUTEX(shmSegmentsMutex);
+	std::vector<U32> processSegments;
 
-	for (auto& display : displays) {
-		if (display.value->processId == pid) {
-			processDisplays.push_back(display.value);
+	for (auto& segment : shmSegments) {
+		if (segment.value->pid == pid) {
+			processSegments.push_back(segment.key);
 		}
 	}
-	for (auto& display : processDisplays) {
-		displays.remove(display->displayId);
+	for (U32 shmseg : processSegments) {
+		shmSegments.remove(shmseg);
 	}
 }
 
@@ -20,11 +20,31 @@
 #define __X_SERVER_H__
 
 #define XI_DEVICE_ID 1
+#define SHM_EVENT_BASE 64
 
 #define XServerPtr std::shared_ptr<XServer>
 
 #define XServerDisplayDataPtr std::shared_ptr<XServerDisplayData>
 
+// A SysV shm segment that a client attached with XShmAttach.  The server holds on to the pages, so images in it can be
+// read straight from them even after the client marks the segment for removal.
+class XShmSegment {
+public:
+	XShmSegment(U32 id, const std::shared_ptr<SHM>& shm, U32 address, U32 pid) : id(id), shm(shm), address(address), pid(pid) {
+		this->shm->incAttach();
+	}
+	~XShmSegment() {
+		this->shm->decAttach();
+	}
+
+	const U32 id;
+	const std::shared_ptr<SHM> shm;
+	const U32 address; // where the client has it mapped
+	const U32 pid;
+};
+
+#define XShmSegmentPtr std::shared_ptr<XShmSegment>
+
 class XServer {
 public:	
 	static XServer* getServer(bool existingOnly = false);
@@ -41,6 +61,7 @@ public:
 	U32 getNextQuark();
 	U32 getExtensionInput2() {return this->extensionXinput2;}
 	U32 getExtensionGLX() {return this->extensionGLX;}
+	U32 getExtensionShm() {return this->extensionShm;}
 
 	XWindowPtr createNewWindow(U32 displayId, const XWindowPtr& parent, U32 width, U32 height, U32 depth, U32 x, U32 y, U32 c_class, U32 border_width, const VisualPtr& visual);
 	XWindowPtr getWindow(U32 window);
@@ -56,6 +77,10 @@ public:
 	void removeGC(U32 gc);
 
 	XDrawablePtr getDrawable(U32 xid);	
+
+	U32 shmAttach(const std::shared_ptr<SHM>& shm, U32 address, U32 pid);
+	XShmSegmentPtr getShmSegment(U32 shmseg);
+	bool shmDetach(U32 shmseg);
 	
 	void addCursor(const XCursorPtr& cursor);
 	XCursorPtr getCursor(U32 id);
@@ -131,6 +156,7 @@ private:
 
 	U32 extensionXinput2;
 	U32 extensionGLX;
+	U32 extensionShm;
 
 	BOXEDWINE_MUTEX atomMutex;
 	BHashTable<U32, BString> atoms;
@@ -155,6 +181,9 @@ private:
 	BOXEDWINE_MUTEX cursorsMutex;
 	BHashTable<U32, XCursorPtr> cursors;
 
+	BOXEDWINE_MUTEX shmSegmentsMutex;
+	BHashTable<U32, XShmSegmentPtr> shmSegments;
+
 	BOXEDWINE_MUTEX colorMapMutex;
 	BHashTable<U32, XColorMapPtr> colorMaps;
 	XColorMapPtr defaultColorMap;
@@ -874,6 +874,19 @@ int XWindow::reparentWindow(const XWindowPtr& parent, S32 x, S32 y) {
 }
 
 void XWindow::setDirty() {
+	lockData();
+	damage.addAll(width(), height());
+	unlockData();
+	if (!isDirty) {
+		isDirty = true;
+		XServer::getServer()->isDisplayDirty = true;
+	}
+}
+
+void XWindow::setDirty(S32 x, S32 y, U32 width, U32 height) {
+	lockData();
+	damage.add(x, y, width, height, this->width(), this->height());
+	unlockData();
 	if (!isDirty) {
 		isDirty = true;
 		XServer::getServer()->isDisplayDirty = true;
@@ -894,9 +907,15 @@ void XWindow::draw() {
 	S32 screenY = top;
 	//windowToScreen(screenX, screenY);
 	lockData();
-	KNativeSystem::getScreen()->putBitsOnWnd(id, data, visual?visual->bits_per_rgb:32, bytes_per_line, screenX, screenY, width(), height(), palette, isDirty);
-	unlockData();
 	isDirty = false;
+	if (colorMap && (colorMap->id != drawnColorMapId || colorMap->generation != drawnColorMapGeneration)) {
+		drawnColorMapId = colorMap->id;
+		drawnColorMapGeneration = colorMap->generation;
+		damage.addAll(width(), height());
+	}
+	KNativeSystem::getScreen()->putBitsOnWnd(id, data, visual?visual->bits_per_rgb:32, bytes_per_line, screenX, screenY, width(), height(), palette, damage);
+	damage.clear();
+	unlockData();
 
 	iterateMappedChildrenBackToFront([](const XWindowPtr& child) {
 		child->draw();
@@ -203,6 +203,7 @@ public:
 
 	void draw();
 	void setDirty() override;
+	void setDirty(S32 x, S32 y, U32 width, U32 height) override;
 	XWindowPtr getWindowFromPoint(S32 screenX, S32 screenY);
 
 	void focusOut();
@@ -227,6 +228,9 @@ private:
 	XSetWindowAttributes attributes;
 	bool isMapped = false;	
 	bool isFullScreen = false;
+	// the palette the cached screen bits were converted with, a new one means the whole window needs converting
+	U32 drawnColorMapId = 0;
+	U32 drawnColorMapGeneration = 0;
 	std::weak_ptr<XWindow> transientCached;
 	XRectangle restoreRect;
 
@@ -252,4 +252,5 @@
 #define X11_CURSOR_LIBRARY_LOAD_CURSOR 203
 #define X11_INSTALL_COLORMAP 204
 #define X11_PUT_BACK_EVENT 205
-#define X11_COUNT 206
+#define X11_SHM_DESTROY_IMAGE 206
+#define X11_COUNT 207
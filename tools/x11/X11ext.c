@@ -42,14 +42,60 @@ Bool XShmAttach(Display* dpy, XShmSegmentInfo* shminfo) {
 	CALL_2_R(X11_SHM_ATTACH, dpy, shminfo);
 }
 
-XImage* XShmCreateImage(Display* dpy, Visual* visual, unsigned int depth, int format, char* data, XShmSegmentInfo* shminfo, unsigned int width, unsigned int height) {
+XImage* XShmCreateImage1(Display* dpy, Visual* visual, unsigned int depth, int format, char* data, XShmSegmentInfo* shminfo, unsigned int width, unsigned int height) {
 	CALL_8_R(X11_SHM_CREATE_IMAGE, dpy, visual, depth, format, data, shminfo, width, height);
 }
 
+// the data belongs to the shared memory segment, so only the XImage is freed
+static int XShmDestroyImage(XImage* ximage) {
+	CALL_1_R(X11_SHM_DESTROY_IMAGE, ximage);
+}
+
+XImage* XShmCreateImage(Display* dpy, Visual* visual, unsigned int depth, int format, char* data, XShmSegmentInfo* shminfo, unsigned int width, unsigned int height) {
+	XImage* image = XShmCreateImage1(dpy, visual, depth, format, data, shminfo, width, height);
+	if (!image) {
+		return image;
+	}
+	image->f.destroy_image = XShmDestroyImage;
+	image->f.get_pixel = XGetPixel;
+	image->f.put_pixel = XPutPixel;
+	image->f.sub_image = XSubImage;
+	image->f.add_pixel = XAddPixel;
+	image->f.create_image = XCreateImage;
+	return image;
+}
+
 Bool XShmDetach(Display* dpy, XShmSegmentInfo* shminfo) {
 	CALL_2_R(X11_SHM_DETACH, dpy, shminfo);
 }
 
 Bool XShmPutImage(Display* dpy, Drawable d, GC gc, XImage* image, int src_x, int src_y, int dst_x, int dst_y, unsigned int src_width, unsigned int src_height, Bool send_event) {
 	CALL_11_R(X11_SHM_PUT_IMAGE, dpy, d, gc, image, src_x, src_y, dst_x, dst_y, src_width, src_height, send_event);
-}
\ No newline at end of file
+}
+
+Bool XShmQueryExtension(Display* dpy) {
+	int major, event, error;
+	return XQueryExtension(dpy, "MIT-SHM", &major, &event, &error);
+}
+
+Bool XShmQueryVersion(Display* dpy, int* majorVersion, int* minorVersion, Bool* sharedPixmaps) {
+	if (!XShmQueryExtension(dpy)) {
+		return False;
+	}
+	*majorVersion = 1;
+	*minorVersion = 1;
+	*sharedPixmaps = False;
+	return True;
+}
+
+int XShmPixmapFormat(Display* dpy) {
+	return ZPixmap;
+}
+
+int XShmGetEventBase(Display* dpy) {
+	int major, event, error;
+	if (!XQueryExtension(dpy, "MIT-SHM", &major, &event, &error)) {
+		return -1;
+	}
+	return event;
+}